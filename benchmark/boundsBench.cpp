@@ -0,0 +1,251 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// boundsBench.cpp
+//
+// Compares the bounding boxes that OpenCSG computes from object-space
+// bounding boxes with those computed from hull points, on the cube rack
+// scene of the example program rotating around the y axis. Reports the
+// number of batches of subtracted primitives, the area covered by the
+// scissor regions of these batches, and the time for projecting the
+// bounding boxes. Requires no OpenGL context.
+//
+
+#include <opencsg.h>
+#include "batch.h"
+#include "openglHelper.h"
+#include "projection.h"
+#include "scissorMemo.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+namespace {
+
+    const int width = 512;
+    const int height = 512;
+    const int frames = 360;
+    const int repetitions = 10;
+
+    class BoundsPrimitive : public OpenCSG::Primitive {
+    public:
+        BoundsPrimitive(OpenCSG::Operation o) : OpenCSG::Primitive(o, 1) {}
+        virtual void render() {}
+    };
+
+    void identity(float m[16]) {
+        for (int i = 0; i < 16; ++i) {
+            m[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        }
+    }
+
+    void translate(float m[16], float x, float y, float z) {
+        identity(m);
+        m[12] = x; m[13] = y; m[14] = z;
+    }
+
+    // gluPerspective
+    void perspective(float m[16], double fovy, double aspect, double zNear, double zFar) {
+        const double f = 1.0 / std::tan(fovy * 3.14159265358979 / 360.0);
+        for (int i = 0; i < 16; ++i) {
+            m[i] = 0.0f;
+        }
+        m[0]  = static_cast<float>(f / aspect);
+        m[5]  = static_cast<float>(f);
+        m[10] = static_cast<float>((zFar + zNear) / (zNear - zFar));
+        m[11] = -1.0f;
+        m[14] = static_cast<float>(2.0 * zFar * zNear / (zNear - zFar));
+    }
+
+    // gluLookAt(0, 2, 5, 0, 0, 0, 0, 1, 0) followed by glRotatef(angle, 0, 1, 0)
+    void modelview(float m[16], float angle) {
+        const double len = std::sqrt(4.0 + 25.0);
+        const float fy = static_cast<float>(-2.0 / len);
+        const float fz = static_cast<float>(-5.0 / len);
+        // side = (1, 0, 0), up = side x forward
+        const float uy = -fz, uz = fy;
+
+        float view[16];
+        identity(view);
+        view[5] = uy;  view[9]  = uz;
+        view[6] = -fy; view[10] = -fz;
+        view[13] = -(uy * 2.0f + uz * 5.0f);
+        view[14] = fy * 2.0f + fz * 5.0f;
+
+        const double a = angle * 3.14159265358979 / 180.0;
+        float rot[16];
+        identity(rot);
+        rot[0] = static_cast<float>(std::cos(a));  rot[8]  = static_cast<float>(std::sin(a));
+        rot[2] = static_cast<float>(-std::sin(a)); rot[10] = static_cast<float>(std::cos(a));
+
+        OpenCSG::Algo::multMatrix(view, rot, m);
+    }
+
+    // vertices of a polyhedron like glutSolidSphere(radius, slices, stacks),
+    // but enlarged such that it encloses the sphere of the given radius
+    std::vector<float> enclosingSpherePoints(float r, int slices, int stacks) {
+        const double radius = r / (std::cos(3.14159265358979 / slices) * std::cos(3.14159265358979 / stacks));
+        std::vector<float> points;
+        points.push_back(0.0f); points.push_back(0.0f); points.push_back(static_cast<float>(radius));
+        points.push_back(0.0f); points.push_back(0.0f); points.push_back(static_cast<float>(-radius));
+        for (int i = 1; i < stacks; ++i) {
+            const double theta = 3.14159265358979 * i / stacks;
+            for (int j = 0; j < slices; ++j) {
+                const double phi = 2.0 * 3.14159265358979 * j / slices;
+                points.push_back(static_cast<float>(radius * std::sin(theta) * std::cos(phi)));
+                points.push_back(static_cast<float>(radius * std::sin(theta) * std::sin(phi)));
+                points.push_back(static_cast<float>(radius * std::cos(theta)));
+            }
+        }
+        return points;
+    }
+
+    // the primitives of setCubeRack() in the example, with either object
+    // bounding boxes or hull points. The hull points of the spheres are
+    // the 86 vertices of an enclosing polyhedron.
+    void setCubeRack(std::vector<OpenCSG::Primitive*>& primitives, bool hull) {
+        const float cube[24] = {
+            -1.0f, -1.0f, -1.0f,   1.0f, -1.0f, -1.0f,  -1.0f,  1.0f, -1.0f,   1.0f,  1.0f, -1.0f,
+            -1.0f, -1.0f,  1.0f,   1.0f, -1.0f,  1.0f,  -1.0f,  1.0f,  1.0f,   1.0f,  1.0f,  1.0f
+        };
+        OpenCSG::Primitive* box = new BoundsPrimitive(OpenCSG::Intersection);
+        if (hull) {
+            box->setHullPoints(cube, 8);
+        } else {
+            box->setObjectBoundingBox(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+        }
+        primitives.push_back(box);
+
+        const float r = 0.58f;
+        const std::vector<float> sphere = enclosingSpherePoints(r, 12, 8);
+
+        for (int x=3; x>=0; --x) {
+            for (int y=3; y>=0; --y) {
+                for (int z=3; z>=0; --z) {
+                    for (int mx=-1; mx<=1 && mx<=x; mx+=2) {
+                        for (int my=-1; my<=1 && my<=y; my+=2) {
+                            for (int mz=-1; mz<=1 && mz<=z; mz+=2) {
+                                float t[16];
+                                translate(t, float(x*mx)/6.0f, float(y*my)/6.0f, float(z*mz)/6.0f);
+                                OpenCSG::Primitive* p = new BoundsPrimitive(OpenCSG::Subtraction);
+                                if (hull) {
+                                    p->setHullPoints(&sphere[0], static_cast<unsigned int>(sphere.size() / 3), t);
+                                } else {
+                                    p->setObjectBoundingBox(-r, -r, -r, r, r, r, t);
+                                }
+                                primitives.push_back(p);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    struct Result {
+        double batches;
+        std::size_t minBatches;
+        std::size_t maxBatches;
+        double fillArea;
+        double projectionTime;
+    };
+
+    Result run(bool hull) {
+        std::vector<OpenCSG::Primitive*> primitives;
+        setCubeRack(primitives, hull);
+
+        std::vector<OpenCSG::Primitive*> intersected;
+        std::vector<OpenCSG::Primitive*> subtracted;
+        for (std::vector<OpenCSG::Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            if ((*itr)->getOperation() == OpenCSG::Intersection) {
+                intersected.push_back(*itr);
+            } else {
+                subtracted.push_back(*itr);
+            }
+        }
+
+        perspective(OpenCSG::OpenGL::projection, 40.0, 1.0, 0.2, 10.0);
+        OpenCSG::OpenGL::canvasPos[0] = OpenCSG::OpenGL::scissorPos[0] = 0;
+        OpenCSG::OpenGL::canvasPos[1] = OpenCSG::OpenGL::scissorPos[1] = 0;
+        OpenCSG::OpenGL::canvasPos[2] = OpenCSG::OpenGL::scissorPos[2] = width;
+        OpenCSG::OpenGL::canvasPos[3] = OpenCSG::OpenGL::scissorPos[3] = height;
+
+        Result result;
+        result.batches = 0.0;
+        result.minBatches = subtracted.size();
+        result.maxBatches = 0;
+        result.fillArea = 0.0;
+        result.projectionTime = 0.0;
+
+        for (int frame = 0; frame < frames; ++frame) {
+            modelview(OpenCSG::OpenGL::modelview, static_cast<float>(frame));
+
+            std::clock_t start = std::clock();
+            for (int i = 0; i < repetitions; ++i) {
+                OpenCSG::Algo::projectBoundingBoxes(primitives);
+            }
+            result.projectionTime += static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC / repetitions;
+
+            OpenCSG::Batcher batches(subtracted);
+            result.batches += static_cast<double>(batches.size());
+            if (batches.size() < result.minBatches) result.minBatches = batches.size();
+            if (batches.size() > result.maxBatches) result.maxBatches = batches.size();
+
+            OpenCSG::ScissorMemo scissor;
+            scissor.setIntersected(intersected);
+            for (std::vector<OpenCSG::Batch>::const_iterator itr = batches.begin(); itr != batches.end(); ++itr) {
+                scissor.setCurrent(*itr);
+                const OpenCSG::NDCVolume& area = scissor.getCurrentArea();
+                if (area.maxx > area.minx && area.maxy > area.miny) {
+                    result.fillArea += 0.25 * (area.maxx - area.minx) * width * (area.maxy - area.miny) * height;
+                }
+            }
+        }
+
+        for (std::vector<OpenCSG::Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            delete *itr;
+        }
+
+        result.batches /= frames;
+        result.fillArea /= frames;
+        result.projectionTime /= frames;
+        return result;
+    }
+
+    void print(const char* name, const Result& result) {
+        std::printf("%-12s %8.1f %5u %5u %14.0f %16.1f\n", name,
+                    result.batches,
+                    static_cast<unsigned int>(result.minBatches),
+                    static_cast<unsigned int>(result.maxBatches),
+                    result.fillArea,
+                    result.projectionTime * 1.0e6);
+    }
+
+} // unnamed namespace
+
+int main() {
+    std::printf("cube rack, %d frames rotating around the y axis, %dx%d pixels\n\n", frames, width, height);
+    std::printf("%-12s %8s %5s %5s %14s %16s\n", "bounds", "batches", "min", "max", "fill area (px)", "projection (us)");
+    print("object box", run(false));
+    print("hull points", run(true));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,303 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// cpuBench.cpp
+//
+// Microbenchmark of the CPU-side algorithms of OpenCSG, which work on
+// bounding boxes only: the Batcher, the sequencers of the SCS algorithm,
+// the ScissorMemo and the overlap tests in Algo. Synthetic scenes of
+// 10 up to 100000 primitives are generated with uniformly distributed,
+// clustered, grid-aligned and long thin bounding boxes. The box sizes
+// shrink with the number of primitives, such that the average number of
+// boxes covering a point stays about the same. Since the Batcher is
+// quadratic in the number of primitives, the largest scenes take minutes.
+// Requires no OpenGL context.
+//
+// Usage: opencsgcpubench [--max N]
+//
+
+#include <opencsg.h>
+#include "batch.h"
+#include "openglHelper.h"
+#include "primitiveHelper.h"
+#include "scissorMemo.h"
+#include "sequencer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+namespace {
+
+    const double minTime = 0.2;               // seconds measured per algorithm at least
+    const std::size_t maxIterations = 10000000; // longer sequences are only partially traversed
+    const std::size_t minIterations = 1000000;
+    const std::size_t overlapTests = 1000000;
+    const unsigned int depthComplexity = 8;   // for BouncingSequencer::sizeForDepthComplexity()
+
+    class BoxPrimitive : public OpenCSG::Primitive {
+    public:
+        BoxPrimitive(OpenCSG::Operation o) : OpenCSG::Primitive(o, 1) {}
+        virtual void render() {}
+    };
+
+    /// small deterministic random number generator, such that
+    /// results are comparable between platforms
+    class Random {
+    public:
+        Random(unsigned int seed) : mState(seed) {}
+        /// returns a number in [0, 1)
+        float next() {
+            mState = mState * 1664525u + 1013904223u;
+            return static_cast<float>(mState >> 8) / 16777216.0f;
+        }
+        /// returns a number in [a, b)
+        float next(float a, float b) {
+            return a + (b - a) * next();
+        }
+    private:
+        unsigned int mState;
+    };
+
+    OpenCSG::Primitive* createBox(std::size_t i, float x, float y, float z, float dx, float dy, float dz) {
+        // every fourth primitive is intersected, the others are subtracted
+        OpenCSG::Primitive* p = new BoxPrimitive(i % 4 == 0 ? OpenCSG::Intersection : OpenCSG::Subtraction);
+        p->setBoundingBox(x - dx, y - dy, (std::max)(0.0f, z - dz),
+                          x + dx, y + dy, (std::min)(1.0f, z + dz));
+        return p;
+    }
+
+    // half size of a square box such that n boxes cover about four times the viewport
+    float boxSize(std::size_t n) {
+        return 2.0f / std::sqrt(static_cast<float>(n));
+    }
+
+    void generateUniform(std::vector<OpenCSG::Primitive*>& primitives, std::size_t n) {
+        Random r(1);
+        const float s = boxSize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const float x = r.next(-1.0f, 1.0f), y = r.next(-1.0f, 1.0f), z = r.next();
+            primitives.push_back(createBox(i, x, y, z, s * r.next(0.5f, 1.5f), s * r.next(0.5f, 1.5f), 0.1f));
+        }
+    }
+
+    void generateClustered(std::vector<OpenCSG::Primitive*>& primitives, std::size_t n) {
+        Random r(2);
+        const int clusters = 8;
+        float cx[clusters], cy[clusters];
+        for (int c = 0; c < clusters; ++c) {
+            cx[c] = r.next(-0.7f, 0.7f);
+            cy[c] = r.next(-0.7f, 0.7f);
+        }
+        const float s = boxSize(n) * 0.5f;
+        for (std::size_t i = 0; i < n; ++i) {
+            const int c = static_cast<int>(i % clusters);
+            // sum of three uniform numbers approximates a normal distribution
+            const float x = cx[c] + 0.1f * (r.next(-1.0f, 1.0f) + r.next(-1.0f, 1.0f) + r.next(-1.0f, 1.0f));
+            const float y = cy[c] + 0.1f * (r.next(-1.0f, 1.0f) + r.next(-1.0f, 1.0f) + r.next(-1.0f, 1.0f));
+            primitives.push_back(createBox(i, x, y, r.next(), s * r.next(0.5f, 1.5f), s * r.next(0.5f, 1.5f), 0.1f));
+        }
+    }
+
+    void generateGrid(std::vector<OpenCSG::Primitive*>& primitives, std::size_t n) {
+        const std::size_t cells = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n))));
+        const float cell = 2.0f / static_cast<float>(cells);
+        for (std::size_t i = 0; i < n; ++i) {
+            const float x = -1.0f + cell * (static_cast<float>(i % cells) + 0.5f);
+            const float y = -1.0f + cell * (static_cast<float>(i / cells) + 0.5f);
+            // neighboring boxes do not touch
+            primitives.push_back(createBox(i, x, y, 0.5f, 0.45f * cell, 0.45f * cell, 0.1f));
+        }
+    }
+
+    void generateLongThin(std::vector<OpenCSG::Primitive*>& primitives, std::size_t n) {
+        Random r(4);
+        const float s = boxSize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const float x = r.next(-1.0f, 1.0f), y = r.next(-1.0f, 1.0f), z = r.next();
+            const float length = r.next(0.5f, 1.0f);
+            const float width = s * s / 4.0f;
+            if (i & 1) {
+                primitives.push_back(createBox(i, x, y, z, length, width, 0.1f));
+            } else {
+                primitives.push_back(createBox(i, x, y, z, width, length, 0.1f));
+            }
+        }
+    }
+
+    struct Generator {
+        const char* name;
+        void (*generate)(std::vector<OpenCSG::Primitive*>&, std::size_t);
+    };
+
+    const Generator generators[] = {
+        { "uniform",   generateUniform },
+        { "clustered", generateClustered },
+        { "grid",      generateGrid },
+        { "longthin",  generateLongThin }
+    };
+
+    double seconds(std::clock_t start) {
+        return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+    }
+
+    volatile std::size_t sink = 0;
+
+    /// traverses a sequence as done by the SCS algorithm. Returns the
+    /// sequence length and, in time, the time per iteration in seconds.
+    std::size_t traverse(const OpenCSG::Sequencer& sequencer, std::size_t length, double& time) {
+        const std::size_t iterations = (std::min)(length, maxIterations);
+        // short sequences are traversed several times between reading the clock
+        const std::size_t repetitions = (std::max)(std::size_t(1), minIterations / iterations);
+        std::size_t runs = 0;
+        std::clock_t start = std::clock();
+        do {
+            std::size_t sum = 0;
+            for (std::size_t r = 0; r < repetitions; ++r) {
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    sum += sequencer.index(i);
+                }
+            }
+            sink = sink + sum;
+            runs += repetitions;
+        } while (seconds(start) < minTime);
+        time = seconds(start) / static_cast<double>(runs * iterations);
+        return length;
+    }
+
+    void run(const Generator& generator, std::size_t n) {
+        std::vector<OpenCSG::Primitive*> primitives;
+        primitives.reserve(n);
+        generator.generate(primitives, n);
+
+        std::vector<OpenCSG::Primitive*> subtracted;
+        for (std::vector<OpenCSG::Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            if ((*itr)->getOperation() == OpenCSG::Subtraction) {
+                subtracted.push_back(*itr);
+            }
+        }
+
+        // Batcher, on the subtracted primitives as done by the SCS algorithm
+        std::clock_t start = std::clock();
+        OpenCSG::Batcher batcher(subtracted);
+        std::size_t runs = 1;
+        while (seconds(start) < minTime) {
+            OpenCSG::Batcher again(subtracted);
+            ++runs;
+        }
+        const double batchTime = seconds(start) / static_cast<double>(runs);
+        const std::size_t batches = batcher.size();
+
+        // sequencers, over the batches
+        double simpleTime, bouncingTime, schoenfieldTime;
+        OpenCSG::SimpleSequencer simple(batches);
+        OpenCSG::BouncingSequencer bouncing(batches);
+        OpenCSG::SchoenfieldSequencer schoenfield(batches);
+        const std::size_t simpleLength = traverse(simple, simple.size(), simpleTime);
+        const std::size_t bouncingLength = traverse(bouncing, bouncing.sizeForDepthComplexity(depthComplexity), bouncingTime);
+        const std::size_t schoenfieldLength = traverse(schoenfield, schoenfield.size(), schoenfieldTime);
+
+        // ScissorMemo, for all batches of one subtraction pass
+        runs = 0;
+        start = std::clock();
+        do {
+            OpenCSG::ScissorMemo scissor;
+            scissor.setIntersected(primitives);
+            for (std::vector<OpenCSG::Batch>::const_iterator itr = batcher.begin(); itr != batcher.end(); ++itr) {
+                scissor.setCurrent(*itr);
+            }
+            ++runs;
+        } while (seconds(start) < minTime);
+        const double scissorTime = seconds(start) / static_cast<double>(runs);
+
+        // overlap tests, on pseudo-random pairs of primitives
+        std::size_t overlaps = 0;
+        runs = 0;
+        start = std::clock();
+        do {
+            overlaps = 0;
+            std::size_t a = 0, b = n / 2;
+            for (std::size_t i = 0; i < overlapTests; ++i) {
+                a = (a + 1) % n;
+                b = (b + 7919) % n;
+                const OpenCSG::Primitive* pa = primitives[a];
+                const OpenCSG::Primitive* pb = primitives[b];
+                overlaps += OpenCSG::Algo::intersectXY(pa, pb);
+                overlaps += OpenCSG::Algo::intersectXYZ(pa, pb);
+                overlaps += OpenCSG::Algo::containsXY(pa, pb);
+            }
+            sink = sink + overlaps;
+            ++runs;
+        } while (seconds(start) < minTime);
+        const double overlapTime = seconds(start) / static_cast<double>(runs * overlapTests * 3);
+
+        std::printf("%-10s %7u %8u %10.3f %12.0f %9.2f %12.0f %9.2f %12.0f %9.2f %10.3f %8.2f\n",
+                    generator.name,
+                    static_cast<unsigned int>(n),
+                    static_cast<unsigned int>(batches),
+                    batchTime * 1.0e3,
+                    static_cast<double>(simpleLength), simpleTime * 1.0e9,
+                    static_cast<double>(bouncingLength), bouncingTime * 1.0e9,
+                    static_cast<double>(schoenfieldLength), schoenfieldTime * 1.0e9,
+                    scissorTime * 1.0e3,
+                    overlapTime * 1.0e9);
+        std::fflush(stdout);
+
+        for (std::vector<OpenCSG::Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            delete *itr;
+        }
+    }
+
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    std::size_t maxPrimitives = 100000;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 < argc && std::strcmp(argv[i], "--max") == 0) {
+            maxPrimitives = static_cast<std::size_t>(std::atol(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: opencsgcpubench [--max N]\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    OpenCSG::OpenGL::canvasPos[0] = OpenCSG::OpenGL::scissorPos[0] = 0;
+    OpenCSG::OpenGL::canvasPos[1] = OpenCSG::OpenGL::scissorPos[1] = 0;
+    OpenCSG::OpenGL::canvasPos[2] = OpenCSG::OpenGL::scissorPos[2] = 512;
+    OpenCSG::OpenGL::canvasPos[3] = OpenCSG::OpenGL::scissorPos[3] = 512;
+
+    std::printf("sequences of more than %u iterations are timed on their first %u iterations,\n",
+                static_cast<unsigned int>(maxIterations), static_cast<unsigned int>(maxIterations));
+    std::printf("the bouncing sequence is sized for depth complexity %u\n\n", depthComplexity);
+    std::printf("%-10s %7s %8s %10s %12s %9s %12s %9s %12s %9s %10s %8s\n",
+                "scene", "prims", "batches", "batch (ms)",
+                "simple len", "(ns/it)", "bounce len", "(ns/it)", "schoenf len", "(ns/it)",
+                "scissor(ms)", "test(ns)");
+
+    for (std::size_t g = 0; g < sizeof(generators) / sizeof(generators[0]); ++g) {
+        for (std::size_t n = 10; n <= maxPrimitives; n *= 10) {
+            run(generators[g], n);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,254 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// headless.cpp
+//
+
+#include "headless.h"
+#include "includeGl.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/glext.h>
+
+#include <algorithm>
+#include <cstring>
+#include <time.h>
+
+namespace {
+
+    const char* phaseNames[OpenCSG::StatisticsPhaseUnused] = {
+        "depthComplexity", "intersection", "subtraction", "layer", "parity", "merge", "discard"
+    };
+
+} // unnamed namespace
+
+const char* settingName(const Setting* settings, size_t count, int value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (settings[i].value == value)
+            return settings[i].name;
+    }
+    return "";
+}
+
+bool settingValue(const Setting* settings, size_t count, const char* name, int& value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (std::strcmp(settings[i].name, name) == 0) {
+            value = settings[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+void setAlgorithm(int algorithm) {
+    OpenCSG::setOption(OpenCSG::AlgorithmSetting, algorithm == AutoTune ? OpenCSG::Automatic : algorithm);
+    OpenCSG::setOption(OpenCSG::AutoTuneSetting, algorithm == AutoTune ? 1 : 0);
+}
+
+double now() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) * 1000.0 + static_cast<double>(ts.tv_nsec) / 1.0e6;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0.0;
+    const double pos = p * static_cast<double>(sorted.size() - 1);
+    const size_t i = static_cast<size_t>(pos);
+    if (i + 1 >= sorted.size())
+        return sorted.back();
+    const double f = pos - static_cast<double>(i);
+    return sorted[i] * (1.0 - f) + sorted[i + 1] * f;
+}
+
+std::string jsonString(const char* s) {
+    std::string result = "\"";
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\')
+            result += '\\';
+        if (static_cast<unsigned char>(*s) >= 0x20)
+            result += *s;
+    }
+    result += '"';
+    return result;
+}
+
+bool createContext(const char* program, int width, int height, bool coreProfile) {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay)
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0);
+    if (display == EGL_NO_DISPLAY)
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        fprintf(stderr, "%s: cannot initialize EGL\n", program);
+        return false;
+    }
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        fprintf(stderr, "%s: EGL does not support desktop OpenGL\n", program);
+        return false;
+    }
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+        fprintf(stderr, "%s: no OpenGL capable EGL config\n", program);
+        return false;
+    }
+
+    const EGLint coreAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, coreProfile ? coreAttribs : 0);
+    if (context == EGL_NO_CONTEXT
+        || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        fprintf(stderr, "%s: cannot create surfaceless OpenGL context\n", program);
+        return false;
+    }
+
+    PFNGLGENFRAMEBUFFERSPROC genFramebuffers =
+        reinterpret_cast<PFNGLGENFRAMEBUFFERSPROC>(eglGetProcAddress("glGenFramebuffers"));
+    PFNGLBINDFRAMEBUFFERPROC bindFramebuffer =
+        reinterpret_cast<PFNGLBINDFRAMEBUFFERPROC>(eglGetProcAddress("glBindFramebuffer"));
+    PFNGLGENRENDERBUFFERSPROC genRenderbuffers =
+        reinterpret_cast<PFNGLGENRENDERBUFFERSPROC>(eglGetProcAddress("glGenRenderbuffers"));
+    PFNGLBINDRENDERBUFFERPROC bindRenderbuffer =
+        reinterpret_cast<PFNGLBINDRENDERBUFFERPROC>(eglGetProcAddress("glBindRenderbuffer"));
+    PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage =
+        reinterpret_cast<PFNGLRENDERBUFFERSTORAGEPROC>(eglGetProcAddress("glRenderbufferStorage"));
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer =
+        reinterpret_cast<PFNGLFRAMEBUFFERRENDERBUFFERPROC>(eglGetProcAddress("glFramebufferRenderbuffer"));
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC checkFramebufferStatus =
+        reinterpret_cast<PFNGLCHECKFRAMEBUFFERSTATUSPROC>(eglGetProcAddress("glCheckFramebufferStatus"));
+    if (!genFramebuffers || !bindFramebuffer || !genRenderbuffers || !bindRenderbuffer
+        || !renderbufferStorage || !framebufferRenderbuffer || !checkFramebufferStatus)
+    {
+        fprintf(stderr, "%s: framebuffer objects are not supported\n", program);
+        return false;
+    }
+
+    // the default framebuffer of a surfaceless context is incomplete,
+    // so render into a framebuffer object like a window would provide it
+    GLuint fbo, color, depthStencil;
+    genFramebuffers(1, &fbo);
+    bindFramebuffer(GL_FRAMEBUFFER, fbo);
+    genRenderbuffers(1, &color);
+    bindRenderbuffer(GL_RENDERBUFFER, color);
+    renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    genRenderbuffers(1, &depthStencil);
+    bindRenderbuffer(GL_RENDERBUFFER, depthStencil);
+    renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthStencil);
+    if (checkFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "%s: offscreen framebuffer is incomplete\n", program);
+        return false;
+    }
+    glViewport(0, 0, width, height);
+
+    return true;
+}
+
+Measurement::Measurement() :
+    estimatedTime(0.0)
+{
+    for (int i = 0; i < OpenCSG::StatisticsPhaseUnused; ++i) {
+        gpuTime[i] = 0.0;
+    }
+}
+
+void measure(void (*frame)(int f, int frames), int frames,
+             OpenCSG::TraceCallback* trace, Measurement& measurement) {
+    frame(0, frames);
+    glFinish();
+
+    measurement = Measurement();
+    measurement.times.reserve(frames);
+    for (int f = 0; f < frames; ++f) {
+        OpenCSG::resetStatistics();
+        if (trace && f + 1 == frames)
+            OpenCSG::setTraceCallback(trace);
+        const double start = now();
+        frame(f, frames);
+        glFinish();
+        measurement.times.push_back(now() - start);
+        OpenCSG::setTraceCallback(0);
+
+        // GPU times of the previous frame, read back during this one
+        const OpenCSG::Statistics& stats = OpenCSG::getStatistics();
+        for (int i = 0; i < OpenCSG::StatisticsPhaseUnused; ++i) {
+            measurement.gpuTime[i] += stats.gpuTime[i];
+        }
+        measurement.estimatedTime += stats.estimatedTime;
+    }
+
+    std::sort(measurement.times.begin(), measurement.times.end());
+}
+
+void writeMeasurement(std::FILE* out, const Measurement& measurement) {
+    const std::vector<double>& times = measurement.times;
+    const double frames = static_cast<double>(times.size());
+    double sum = 0.0;
+    for (std::vector<double>::const_iterator it = times.begin(); it != times.end(); ++it) {
+        sum += *it;
+    }
+
+    fprintf(out, "\"ms\": {\"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f}, ",
+            sum / frames, times.front(),
+            percentile(times, 0.5), percentile(times, 0.9), percentile(times, 0.99), times.back());
+    fprintf(out, "\"estimatedMs\": %.4f, ", measurement.estimatedTime / frames);
+
+    // statistics of the last frame
+    const OpenCSG::Statistics& stats = OpenCSG::getStatistics();
+    unsigned int renderCalls = 0;
+    for (int i = 0; i < OpenCSG::StatisticsPhaseUnused; ++i) {
+        renderCalls += stats.renderCalls[i];
+    }
+    fprintf(out, "\"lastFrame\": {\"algorithm\": \"%s\", \"depthComplexityAlgorithm\": \"%s\", ",
+            settingName(algorithms, countOf(algorithms), stats.algorithm),
+            settingName(depthComplexityAlgorithms, countOf(depthComplexityAlgorithms), stats.depthComplexityAlgorithm));
+    fprintf(out, "\"cameraOutside\": \"%s\", ",
+            settingName(cameraOutsideOptimizations, countOf(cameraOutsideOptimizations), stats.cameraOutsideOptimization));
+    fprintf(out, "\"batches\": %u, \"sequenceIterations\": %u, \"layers\": %u, \"renderCalls\": %u, \"channelMerges\": %u, \"occlusionQueries\": %u, \"depthComplexity\": %u, ",
+            stats.batches, stats.sequenceIterations, stats.layers, renderCalls,
+            stats.channelMerges, stats.occlusionQueries, stats.depthComplexity);
+    fprintf(out, "\"tiles\": %u, \"skippedTiles\": %u}", stats.tiles, stats.skippedTiles);
+
+    // mean GPU time per frame of each phase
+    if (stats.gpuTimedRenders > 0) {
+        fprintf(out, ", \"gpuMs\": {");
+        for (int i = 0; i < OpenCSG::StatisticsPhaseUnused; ++i) {
+            fprintf(out, "%s\"%s\": %.4f", i == 0 ? "" : ", ", phaseNames[i], measurement.gpuTime[i] / frames);
+        }
+        fprintf(out, "}");
+    }
+}
@@ -0,0 +1,114 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// headless.h
+//
+// Helpers shared by the headless benchmarks opencsgbench and opencsgreplay:
+// the offscreen OpenGL context created with EGL, the names of the OpenCSG
+// settings, and measuring and writing the timings of frames as JSON.
+//
+
+#ifndef __OpenCSG__headless_h__
+#define __OpenCSG__headless_h__
+
+#include <opencsg.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct Setting {
+    const char* name;
+    int value;
+};
+
+// Automatic with the AutoTuneSetting
+const int AutoTune = -1;
+
+const Setting algorithms[] = {
+    { "Goldfeather", OpenCSG::Goldfeather },
+    { "SCS",         OpenCSG::SCS },
+    { "Automatic",   OpenCSG::Automatic },
+    { "AutoTune",    AutoTune }
+};
+
+const Setting depthComplexityAlgorithms[] = {
+    { "NoDepthComplexitySampling", OpenCSG::NoDepthComplexitySampling },
+    { "OcclusionQuery",            OpenCSG::OcclusionQuery },
+    { "DepthComplexitySampling",   OpenCSG::DepthComplexitySampling }
+};
+
+const Setting cameraOutsideOptimizations[] = {
+    { "OptimizationDefault",   OpenCSG::OptimizationDefault },
+    { "OptimizationOn",        OpenCSG::OptimizationOn },
+    { "OptimizationOff",       OpenCSG::OptimizationOff },
+    { "OptimizationAutomatic", OpenCSG::OptimizationAutomatic }
+};
+
+template <typename T, size_t N>
+size_t countOf(const T (&)[N]) { return N; }
+
+/// returns the name of the setting with the value, or "" if there is none
+const char* settingName(const Setting* settings, size_t count, int value);
+/// returns the setting with the name in value, or false if there is none
+bool settingValue(const Setting* settings, size_t count, const char* name, int& value);
+
+/// sets the AlgorithmSetting and the AutoTuneSetting for an algorithm
+/// of the table above, which includes AutoTune
+void setAlgorithm(int algorithm);
+
+/// milliseconds of a monotonic clock
+double now();
+
+/// percentile of sorted values, with linear interpolation
+double percentile(const std::vector<double>& sorted, double p);
+
+/// the string in quotes, with quotes and backslashes escaped
+std::string jsonString(const char* s);
+
+/// creates an offscreen OpenGL context with EGL (surfaceless platform,
+/// e.g., Mesa llvmpipe), either a 3.3 core profile context or one with
+/// default attributes (compatibility profile), and makes a framebuffer
+/// object of width x height pixels with depth and stencil current.
+/// Reports errors on stderr, prefixed with the name of the program.
+bool createContext(const char* program, int width, int height, bool coreProfile);
+
+/// the timings of a series of frames
+struct Measurement {
+    Measurement();
+
+    /// the wall clock time of each frame in milliseconds, sorted
+    std::vector<double> times;
+    /// the sum of the GPU times of each phase over all frames
+    double gpuTime[OpenCSG::StatisticsPhaseUnused];
+    /// the sum of the estimated times over all frames
+    double estimatedTime;
+};
+
+/// renders a warm-up frame, which may compile shaders and allocate
+/// offscreen buffers and is not part of the measurement, and then the
+/// frames, each with frame(f, frames) and glFinish(). The scopes of the
+/// last frame are reported to trace, if not 0.
+void measure(void (*frame)(int f, int frames), int frames,
+             OpenCSG::TraceCallback* trace, Measurement& measurement);
+
+/// writes the timings as JSON members "ms", "estimatedMs" and "gpuMs",
+/// and the OpenCSG statistics of the last frame as "lastFrame"
+void writeMeasurement(std::FILE* out, const Measurement& measurement);
+
+#endif
@@ -0,0 +1,326 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// opencsgBench.cpp
+//
+// Headless counterpart of the benchmark mode of the example program.
+// Creates an offscreen OpenGL context with EGL (surfaceless platform,
+// e.g., Mesa llvmpipe), renders the example scenes for every combination
+// of Algorithm, DepthComplexityAlgorithm and CameraOutsideOptimization
+// while spinning the model once, and writes per-frame timing statistics
+// as JSON, together with the OpenCSG statistics of the last frame, the
+// GPU time of the phases of the CSG algorithms and the time estimated by
+// the cost model of the Automatic setting. The Automatic setting itself,
+// and Automatic with the AutoTuneSetting ("AutoTune"), are measured as
+// well, together with the settings they have chosen in the last frame.
+// With --trace, the scopes of render() in the last frame of every
+// combination are written to a Chrome trace file. With --autotune, the
+// settings learned by AutoTune are loaded from the file, if it exists,
+// and written back at the end. With --capture, the first call of render()
+// is captured to a file for opencsgreplay. With --resolution, all
+// combinations are rendered with the given ResolutionSetting, and with
+// --tile-size, with the given TileSizeSetting. With --check, only the
+// Automatic setting is compared against the thresholds it has replaced
+// (SCS for convex and Goldfeather for concave primitives, occlusion
+// queries beyond 20 primitives), and the program fails if Automatic is
+// slower on any scene.
+//
+// Usage: opencsgbench [--frames N] [--size N] [--scene name] [--output file]
+//                     [--trace file] [--autotune file] [--capture file]
+//                     [--resolution N] [--tile-size N] [--check]
+//
+
+#include <opencsg.h>
+#include "headless.h"
+#include "scenes.h"
+#include "includeGl.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+    struct Scene {
+        const char* name;
+        void (*setup)();
+        bool convex;
+    };
+
+    const Scene scenes[] = {
+        { "simple",   setBasicShape, true  },
+        { "widget",   setWidget,     true  },
+        { "grid2d",   setGrid2D,     true  },
+        { "grid3d",   setGrid3D,     true  },
+        { "cuberack", setCubeRack,   true  },
+        { "pipe",     setPipe,       true  },
+        { "concave",  setConcave,    false }
+    };
+
+    /// the same state as set up by the example program
+    void init() {
+        GLfloat light_diffuse[]   = { 1.0f,  0.0f,  0.0f,  1.0f};
+        GLfloat light_position0[] = {-1.0f, -1.0f, -1.0f,  0.0f};
+        GLfloat light_position1[] = { 1.0f,  1.0f,  1.0f,  0.0f};
+
+        glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
+        glLightfv(GL_LIGHT0, GL_POSITION, light_position0);
+        glEnable(GL_LIGHT0);
+        glLightfv(GL_LIGHT1, GL_DIFFUSE, light_diffuse);
+        glLightfv(GL_LIGHT1, GL_POSITION, light_position1);
+        glEnable(GL_LIGHT1);
+        glEnable(GL_LIGHTING);
+        glEnable(GL_NORMALIZE);
+
+        glEnable(GL_DEPTH_TEST);
+
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        gluPerspective(40.0, 1.0, 0.2, 10.0);
+        glMatrixMode(GL_MODELVIEW);
+    }
+
+    void renderPrimitives(const std::vector<OpenCSG::Primitive*>& p) {
+        for (std::vector<OpenCSG::Primitive*>::const_iterator itr = p.begin(); itr != p.end(); ++itr) {
+            (*itr)->render();
+        }
+    }
+
+    /// the display function of the example program, for the camera outside
+    void display(float rot) {
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+        gluLookAt(0.0, 2.0, 5.0,
+                  0.0, 0.0, 0.0,
+                  0.0, 1.0, 0.0);
+        glRotatef(rot, 0.0f, 1.0f, 0.0f);
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        OpenCSG::render(primitives);
+        OpenCSG::render(primitives2);
+        OpenCSG::render(primitives3);
+        glDepthFunc(GL_EQUAL);
+        renderPrimitives(primitives);
+        renderPrimitives(primitives2);
+        renderPrimitives(primitives3);
+        glDepthFunc(GL_LESS);
+    }
+
+    /// spins the model once over all frames
+    void frame(int f, int frames) {
+        display(360.0f * static_cast<float>(f) / static_cast<float>(frames));
+    }
+
+    size_t largestProduct() {
+        return (std::max)(primitives.size(), (std::max)(primitives2.size(), primitives3.size()));
+    }
+
+    /// the median frame time of a combination of settings
+    double medianTime(int algorithm, int depthComplexityAlgorithm, int frames, Measurement& measurement) {
+        setAlgorithm(algorithm);
+        OpenCSG::setOption(OpenCSG::DepthComplexitySetting, depthComplexityAlgorithm);
+        OpenCSG::setOption(OpenCSG::CameraOutsideOptimization, OpenCSG::OptimizationDefault);
+        measure(frame, frames, 0, measurement);
+        return percentile(measurement.times, 0.5);
+    }
+
+    /// compares the Automatic setting against the thresholds used before
+    /// the cost model, which all contexts created here support occlusion
+    /// queries for. Returns false if Automatic is slower on any scene.
+    bool check(const char* sceneFilter, int frames) {
+        // tolerance for the noise of the timings
+        const double tolerance = 1.25;
+
+        bool passed = true;
+        Measurement measurement;
+        for (size_t s = 0; s < countOf(scenes); ++s) {
+            if (sceneFilter && std::strcmp(sceneFilter, scenes[s].name) != 0)
+                continue;
+            scenes[s].setup();
+
+            const int algorithm = scenes[s].convex ? OpenCSG::SCS : OpenCSG::Goldfeather;
+            const int depthComplexityAlgorithm = largestProduct() > 20 ? OpenCSG::OcclusionQuery : OpenCSG::NoDepthComplexitySampling;
+            const double threshold = medianTime(algorithm, depthComplexityAlgorithm, frames, measurement);
+
+            const double automatic = medianTime(OpenCSG::Automatic, OpenCSG::NoDepthComplexitySampling, frames, measurement);
+            const OpenCSG::Statistics& stats = OpenCSG::getStatistics();
+
+            const bool ok = automatic <= threshold * tolerance;
+            printf("%-8s %s: Automatic %.2f ms (%s, %s), thresholds %.2f ms (%s, %s)\n",
+                   scenes[s].name, ok ? "ok    " : "SLOWER",
+                   automatic,
+                   settingName(algorithms, countOf(algorithms), stats.algorithm),
+                   settingName(depthComplexityAlgorithms, countOf(depthComplexityAlgorithms), stats.depthComplexityAlgorithm),
+                   threshold,
+                   settingName(algorithms, countOf(algorithms), algorithm),
+                   settingName(depthComplexityAlgorithms, countOf(depthComplexityAlgorithms), depthComplexityAlgorithm));
+            fflush(stdout);
+            passed = passed && ok;
+        }
+        return passed;
+    }
+
+    void usage() {
+        fprintf(stderr, "usage: opencsgbench [--frames N] [--size N] [--scene name] [--output file] [--trace file] [--autotune file] [--capture file] [--resolution N] [--tile-size N] [--check]\n");
+        fprintf(stderr, "scenes:");
+        for (size_t i = 0; i < countOf(scenes); ++i) {
+            fprintf(stderr, " %s", scenes[i].name);
+        }
+        fprintf(stderr, "\n");
+    }
+
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+    int frames = 90;
+    int size = 512;
+    const char* sceneFilter = 0;
+    const char* outputName = 0;
+    const char* traceName = 0;
+    const char* autoTuneName = 0;
+    const char* captureName = 0;
+    int resolution = OpenCSG::FullResolution;
+    int tileSize = 0;
+    bool checkOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 < argc && std::strcmp(argv[i], "--frames") == 0) {
+            frames = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--size") == 0) {
+            size = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--scene") == 0) {
+            sceneFilter = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--output") == 0) {
+            outputName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--trace") == 0) {
+            traceName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--autotune") == 0) {
+            autoTuneName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--capture") == 0) {
+            captureName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--resolution") == 0) {
+            resolution = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--tile-size") == 0) {
+            tileSize = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--check") == 0) {
+            checkOnly = true;
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (frames < 1 || size < 1 || resolution < 0 || resolution >= OpenCSG::ResolutionUnused || tileSize < 0) {
+        usage();
+        return 1;
+    }
+
+    if (!createContext("opencsgbench", size, size, false))
+        return 1;
+    init();
+    OpenCSG::setOption(OpenCSG::StatisticsSetting, 1);
+    OpenCSG::setOption(OpenCSG::GPUTimerSetting, 1);
+    OpenCSG::setOption(OpenCSG::ResolutionSetting, resolution);
+    OpenCSG::setOption(OpenCSG::TileSizeSetting, tileSize);
+    if (autoTuneName)
+        OpenCSG::loadAutoTuning(autoTuneName);
+    if (captureName)
+        OpenCSG::captureNextRender(captureName);
+
+    if (checkOnly) {
+        const bool passed = check(sceneFilter, frames);
+        clearPrimitives();
+        OpenCSG::freeResources();
+        return passed ? 0 : 1;
+    }
+
+    FILE* out = stdout;
+    if (outputName) {
+        out = fopen(outputName, "w");
+        if (!out) {
+            fprintf(stderr, "opencsgbench: cannot open %s\n", outputName);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"renderer\": %s,\n", jsonString(reinterpret_cast<const char*>(glGetString(GL_RENDERER))).c_str());
+    fprintf(out, "  \"version\": %s,\n", jsonString(reinterpret_cast<const char*>(glGetString(GL_VERSION))).c_str());
+    fprintf(out, "  \"size\": %d,\n", size);
+    fprintf(out, "  \"frames\": %d,\n", frames);
+    fprintf(out, "  \"resolution\": %d,\n", resolution);
+    fprintf(out, "  \"tileSize\": %d,\n", tileSize);
+    fprintf(out, "  \"results\": [");
+
+    OpenCSG::ChromeTraceRecorder recorder;
+
+    bool first = true;
+    Measurement measurement;
+
+    for (size_t s = 0; s < countOf(scenes); ++s) {
+        if (sceneFilter && std::strcmp(sceneFilter, scenes[s].name) != 0)
+            continue;
+        scenes[s].setup();
+
+        for (size_t a = 0; a < countOf(algorithms); ++a) {
+            // SCS renders convex primitives only
+            if (algorithms[a].value == OpenCSG::SCS && !scenes[s].convex)
+                continue;
+            // the automatic settings choose the DepthComplexityAlgorithm
+            const bool automatic = algorithms[a].value == OpenCSG::Automatic || algorithms[a].value == AutoTune;
+            for (size_t d = 0; d < countOf(depthComplexityAlgorithms); ++d) {
+                if (automatic && d > 0)
+                    continue;
+                for (size_t c = 0; c < countOf(cameraOutsideOptimizations); ++c) {
+                    setAlgorithm(algorithms[a].value);
+                    OpenCSG::setOption(OpenCSG::DepthComplexitySetting, depthComplexityAlgorithms[d].value);
+                    OpenCSG::setOption(OpenCSG::CameraOutsideOptimization, cameraOutsideOptimizations[c].value);
+
+                    measure(frame, frames, traceName ? &recorder : 0, measurement);
+
+                    fprintf(out, "%s\n    {", first ? "" : ",");
+                    fprintf(out, "\"scene\": \"%s\", ", scenes[s].name);
+                    fprintf(out, "\"algorithm\": \"%s\", ", algorithms[a].name);
+                    fprintf(out, "\"depthComplexity\": \"%s\", ", automatic ? "Automatic" : depthComplexityAlgorithms[d].name);
+                    fprintf(out, "\"cameraOutside\": \"%s\", ", cameraOutsideOptimizations[c].name);
+                    writeMeasurement(out, measurement);
+                    fprintf(out, "}");
+                    fflush(out);
+                    first = false;
+                }
+            }
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (traceName && !recorder.write(traceName)) {
+        fprintf(stderr, "opencsgbench: cannot write %s\n", traceName);
+    }
+    if (autoTuneName && !OpenCSG::saveAutoTuning(autoTuneName)) {
+        fprintf(stderr, "opencsgbench: cannot write %s\n", autoTuneName);
+    }
+    if (out != stdout)
+        fclose(out);
+
+    clearPrimitives();
+    OpenCSG::freeResources();
+
+    return 0;
+}
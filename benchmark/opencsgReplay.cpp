@@ -0,0 +1,402 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// opencsgReplay.cpp
+//
+// Replays calls of render() captured with OpenCSG::captureNextRender(),
+// e.g., in an application in the field, headlessly in an offscreen context
+// created with EGL, and writes per-frame timing statistics as JSON in the
+// format of opencsgbench. The captured primitives are drawn from a buffer
+// object, with the triangles in clip coordinates as recorded, so neither
+// the vertex shader nor the matrices of the application are needed. By
+// default, a capture is replayed with its captured options. --algorithm,
+// --depthcomplexity, --cameraoutside and --option override them, and
+// --sweep measures every combination of Algorithm, DepthComplexityAlgorithm
+// and CameraOutsideOptimization, as opencsgbench does for its scenes. The
+// context has the profile of the first capture, unless --profile is given.
+//
+// Usage: opencsgreplay [--frames N] [--sweep] [--algorithm name]
+//                      [--depthcomplexity name] [--cameraoutside name]
+//                      [--option index value] [--profile core|compatibility]
+//                      [--output file] [--trace file] capture...
+//
+
+#include <opencsg.h>
+#include "headless.h"
+#include "includeGl.h"
+
+#include <EGL/egl.h>
+#include <GL/glext.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    struct CapturedPrimitive {
+        int operation;
+        unsigned int convexity;
+        float box[6];
+        /// range of the vertices in Capture::vertices
+        unsigned int first;
+        unsigned int count;
+    };
+
+    struct Capture {
+        const char* filename;
+        bool coreProfile;
+        std::vector<int> options;
+        int viewport[4];
+        int scissor[5];
+        /// x, y, z, w of each vertex of the triangles, in clip coordinates
+        std::vector<GLfloat> vertices;
+        std::vector<CapturedPrimitive> primitives;
+    };
+
+    /// reads a file written by OpenCSG::captureNextRender(),
+    /// see src/capture.cpp for the format
+    bool readCapture(const char* filename, Capture& capture) {
+        FILE* file = fopen(filename, "r");
+        if (!file)
+            return false;
+
+        capture.filename = filename;
+        char line[1024];
+        char profile[64] = "";
+        int optionCount = 0;
+        bool valid = fgets(line, sizeof(line), file) && std::strncmp(line, "OpenCSG capture 1", 17) == 0
+                  && fgets(line, sizeof(line), file) && std::strncmp(line, "renderer ", 9) == 0
+                  && fscanf(file, " profile %63s", profile) == 1
+                  && fscanf(file, " options %d", &optionCount) == 1 && optionCount >= 0;
+        capture.coreProfile = std::strcmp(profile, "core") == 0;
+        capture.options.resize(valid ? optionCount : 0);
+        for (int i = 0; valid && i < optionCount; ++i) {
+            valid = fscanf(file, "%d", &capture.options[i]) == 1;
+        }
+
+        int* v = capture.viewport;
+        int* s = capture.scissor;
+        float matrix[16];
+        unsigned int length = 0;
+        valid = valid && fscanf(file, " viewport %d %d %d %d", &v[0], &v[1], &v[2], &v[3]) == 4
+                      && fscanf(file, " scissor %d %d %d %d %d", &s[0], &s[1], &s[2], &s[3], &s[4]) == 5;
+        for (int m = 0; valid && m < 2; ++m) {
+            valid = fscanf(file, m == 0 ? " modelview" : " projection") == 0;
+            for (int i = 0; valid && i < 16; ++i) {
+                valid = fscanf(file, "%f", &matrix[i]) == 1;
+            }
+        }
+
+        // the vertex shader is not needed, since the triangles are
+        // captured after transformation
+        valid = valid && fscanf(file, " vertexshader %u", &length) == 1 && fgetc(file) == '\n';
+        for (unsigned int i = 0; valid && i < length; ++i) {
+            valid = fgetc(file) != EOF;
+        }
+
+        unsigned int primitiveCount = 0;
+        valid = valid && fscanf(file, " primitives %u", &primitiveCount) == 1;
+        for (unsigned int p = 0; valid && p < primitiveCount; ++p) {
+            CapturedPrimitive primitive;
+            float* b = primitive.box;
+            unsigned int triangles = 0;
+            valid = fscanf(file, " primitive %d %u %f %f %f %f %f %f %u",
+                           &primitive.operation, &primitive.convexity,
+                           &b[0], &b[1], &b[2], &b[3], &b[4], &b[5], &triangles) == 9;
+            primitive.first = static_cast<unsigned int>(capture.vertices.size() / 4);
+            primitive.count = 3 * triangles;
+            for (unsigned int i = 0; valid && i < 4 * primitive.count; ++i) {
+                float value;
+                valid = fscanf(file, "%f", &value) == 1;
+                capture.vertices.push_back(value);
+            }
+            capture.primitives.push_back(primitive);
+        }
+
+        fclose(file);
+        return valid;
+    }
+
+    template <typename T>
+    bool loadFunction(T& function, const char* name) {
+        function = reinterpret_cast<T>(eglGetProcAddress(name));
+        return function != 0;
+    }
+
+    PFNGLGENVERTEXARRAYSPROC genVertexArrays;
+    PFNGLBINDVERTEXARRAYPROC bindVertexArray;
+    PFNGLGENBUFFERSPROC genBuffers;
+    PFNGLBINDBUFFERPROC bindBuffer;
+    PFNGLBUFFERDATAPROC bufferData;
+    PFNGLVERTEXATTRIBPOINTERPROC vertexAttribPointer;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC enableVertexAttribArray;
+
+    bool loadFunctions() {
+        return loadFunction(genVertexArrays, "glGenVertexArrays")
+            && loadFunction(bindVertexArray, "glBindVertexArray")
+            && loadFunction(genBuffers, "glGenBuffers")
+            && loadFunction(bindBuffer, "glBindBuffer")
+            && loadFunction(bufferData, "glBufferData")
+            && loadFunction(vertexAttribPointer, "glVertexAttribPointer")
+            && loadFunction(enableVertexAttribArray, "glEnableVertexAttribArray");
+    }
+
+    /// creates a BufferPrimitive for each captured primitive, with all
+    /// triangles in a single vertex array object, so that OpenCSG draws
+    /// the primitives of a batch with a single call
+    void createPrimitives(const Capture& capture, bool coreProfile, std::vector<OpenCSG::Primitive*>& primitives) {
+        const unsigned int vertexCount = static_cast<unsigned int>(capture.vertices.size() / 4);
+        std::vector<GLuint> indices(vertexCount);
+        for (unsigned int i = 0; i < vertexCount; ++i) {
+            indices[i] = i;
+        }
+
+        GLuint vertexArray, buffers[2];
+        genVertexArrays(1, &vertexArray);
+        bindVertexArray(vertexArray);
+        genBuffers(2, buffers);
+        bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        bufferData(GL_ARRAY_BUFFER, capture.vertices.size() * sizeof(GLfloat),
+                   capture.vertices.empty() ? 0 : &capture.vertices[0], GL_STATIC_DRAW);
+        vertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, 0);
+        enableVertexAttribArray(0);
+        if (!coreProfile) {
+            glVertexPointer(4, GL_FLOAT, 0, 0);
+            glEnableClientState(GL_VERTEX_ARRAY);
+        }
+        bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+        bufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+                   indices.empty() ? 0 : &indices[0], GL_STATIC_DRAW);
+        bindVertexArray(0);
+
+        for (std::vector<CapturedPrimitive>::const_iterator itr = capture.primitives.begin(); itr != capture.primitives.end(); ++itr) {
+            OpenCSG::Primitive* primitive = new OpenCSG::BufferPrimitive(
+                itr->operation == OpenCSG::Subtraction ? OpenCSG::Subtraction : OpenCSG::Intersection,
+                itr->convexity, vertexArray, itr->first, itr->count);
+            primitive->setBoundingBox(itr->box[0], itr->box[1], itr->box[2], itr->box[3], itr->box[4], itr->box[5]);
+            primitives.push_back(primitive);
+        }
+    }
+
+    const Capture* currentCapture = 0;
+    std::vector<OpenCSG::Primitive*> currentPrimitives;
+
+    /// renders the current capture, like the application did
+    void frame(int, int) {
+        glDisable(GL_SCISSOR_TEST);
+        glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        const int* s = currentCapture->scissor;
+        if (s[0]) {
+            glScissor(s[1], s[2], s[3], s[4]);
+            glEnable(GL_SCISSOR_TEST);
+        }
+        OpenCSG::render(currentPrimitives);
+        glDisable(GL_SCISSOR_TEST);
+    }
+
+    void usage() {
+        fprintf(stderr, "usage: opencsgreplay [--frames N] [--sweep] [--algorithm name] [--depthcomplexity name]\n");
+        fprintf(stderr, "                     [--cameraoutside name] [--option index value] [--profile core|compatibility]\n");
+        fprintf(stderr, "                     [--output file] [--trace file] capture...\n");
+    }
+
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+    int frames = 90;
+    bool sweep = false;
+    const char* outputName = 0;
+    const char* traceName = 0;
+    const char* profile = 0;
+    // overridden options, as pairs of OptionType and setting
+    std::vector<std::pair<int, int> > overrides;
+    std::vector<Capture> captures;
+
+    for (int i = 1; i < argc; ++i) {
+        int value = 0;
+        if (i + 1 < argc && std::strcmp(argv[i], "--frames") == 0) {
+            frames = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--sweep") == 0) {
+            sweep = true;
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--algorithm") == 0
+                   && settingValue(algorithms, countOf(algorithms), argv[i + 1], value)) {
+            overrides.push_back(std::make_pair(static_cast<int>(OpenCSG::AlgorithmSetting), value));
+            ++i;
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--depthcomplexity") == 0
+                   && settingValue(depthComplexityAlgorithms, countOf(depthComplexityAlgorithms), argv[i + 1], value)) {
+            overrides.push_back(std::make_pair(static_cast<int>(OpenCSG::DepthComplexitySetting), value));
+            ++i;
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--cameraoutside") == 0
+                   && settingValue(cameraOutsideOptimizations, countOf(cameraOutsideOptimizations), argv[i + 1], value)) {
+            overrides.push_back(std::make_pair(static_cast<int>(OpenCSG::CameraOutsideOptimization), value));
+            ++i;
+        } else if (i + 2 < argc && std::strcmp(argv[i], "--option") == 0) {
+            overrides.push_back(std::make_pair(std::atoi(argv[i + 1]), std::atoi(argv[i + 2])));
+            i += 2;
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--profile") == 0
+                   && (std::strcmp(argv[i + 1], "core") == 0 || std::strcmp(argv[i + 1], "compatibility") == 0)) {
+            profile = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--output") == 0) {
+            outputName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--trace") == 0) {
+            traceName = argv[++i];
+        } else if (argv[i][0] != '-') {
+            captures.push_back(Capture());
+            if (!readCapture(argv[i], captures.back())) {
+                fprintf(stderr, "opencsgreplay: cannot read %s\n", argv[i]);
+                return 1;
+            }
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (frames < 1 || captures.empty()) {
+        usage();
+        return 1;
+    }
+
+    // the framebuffer holds the viewports of all captures
+    int width = 1, height = 1;
+    for (std::vector<Capture>::const_iterator itr = captures.begin(); itr != captures.end(); ++itr) {
+        width = (std::max)(width, itr->viewport[0] + itr->viewport[2]);
+        height = (std::max)(height, itr->viewport[1] + itr->viewport[3]);
+    }
+    const bool coreProfile = profile ? std::strcmp(profile, "core") == 0 : captures.front().coreProfile;
+    if (!createContext("opencsgreplay", width, height, coreProfile))
+        return 1;
+    if (!loadFunctions()) {
+        fprintf(stderr, "opencsgreplay: vertex array objects are not supported\n");
+        return 1;
+    }
+
+    // the triangles are in clip coordinates already
+    if (!coreProfile) {
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+    }
+    const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                 0.0f, 1.0f, 0.0f, 0.0f,
+                                 0.0f, 0.0f, 1.0f, 0.0f,
+                                 0.0f, 0.0f, 0.0f, 1.0f };
+    OpenCSG::setMatrices(identity, identity);
+    glEnable(GL_DEPTH_TEST);
+
+    FILE* out = stdout;
+    if (outputName) {
+        out = fopen(outputName, "w");
+        if (!out) {
+            fprintf(stderr, "opencsgreplay: cannot open %s\n", outputName);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"renderer\": %s,\n", jsonString(reinterpret_cast<const char*>(glGetString(GL_RENDERER))).c_str());
+    fprintf(out, "  \"version\": %s,\n", jsonString(reinterpret_cast<const char*>(glGetString(GL_VERSION))).c_str());
+    fprintf(out, "  \"frames\": %d,\n", frames);
+    fprintf(out, "  \"results\": [");
+
+    OpenCSG::ChromeTraceRecorder recorder;
+
+    bool first = true;
+    Measurement measurement;
+
+    for (std::vector<Capture>::const_iterator capture = captures.begin(); capture != captures.end(); ++capture) {
+        currentCapture = &*capture;
+        createPrimitives(*capture, coreProfile, currentPrimitives);
+        glViewport(capture->viewport[0], capture->viewport[1], capture->viewport[2], capture->viewport[3]);
+
+        bool convex = true;
+        for (std::vector<CapturedPrimitive>::const_iterator itr = capture->primitives.begin(); itr != capture->primitives.end(); ++itr) {
+            convex = convex && itr->convexity <= 1;
+        }
+
+        for (size_t a = 0; a < countOf(algorithms); ++a) {
+            for (size_t d = 0; d < countOf(depthComplexityAlgorithms); ++d) {
+                for (size_t c = 0; c < countOf(cameraOutsideOptimizations); ++c) {
+                    for (int i = 0; i < static_cast<int>(capture->options.size()); ++i) {
+                        OpenCSG::setOption(static_cast<OpenCSG::OptionType>(i), capture->options[i]);
+                    }
+                    for (std::vector<std::pair<int, int> >::const_iterator itr = overrides.begin(); itr != overrides.end(); ++itr) {
+                        OpenCSG::setOption(static_cast<OpenCSG::OptionType>(itr->first), itr->second);
+                    }
+                    if (sweep) {
+                        // SCS renders convex primitives only, and the
+                        // automatic settings choose the DepthComplexityAlgorithm
+                        const bool automatic = algorithms[a].value == OpenCSG::Automatic || algorithms[a].value == AutoTune;
+                        if ((algorithms[a].value == OpenCSG::SCS && !convex) || (automatic && d > 0))
+                            continue;
+                        setAlgorithm(algorithms[a].value);
+                        OpenCSG::setOption(OpenCSG::DepthComplexitySetting, depthComplexityAlgorithms[d].value);
+                        OpenCSG::setOption(OpenCSG::CameraOutsideOptimization, cameraOutsideOptimizations[c].value);
+                    } else if (a > 0 || d > 0 || c > 0) {
+                        continue;
+                    }
+                    OpenCSG::setOption(OpenCSG::StatisticsSetting, 1);
+                    OpenCSG::setOption(OpenCSG::GPUTimerSetting, 1);
+
+                    measure(frame, frames, traceName ? &recorder : 0, measurement);
+
+                    const int algorithm = OpenCSG::getOption(OpenCSG::AlgorithmSetting) == OpenCSG::Automatic
+                                       && OpenCSG::getOption(OpenCSG::AutoTuneSetting) != 0
+                                        ? AutoTune : OpenCSG::getOption(OpenCSG::AlgorithmSetting);
+                    fprintf(out, "%s\n    {", first ? "" : ",");
+                    fprintf(out, "\"capture\": %s, ", jsonString(capture->filename).c_str());
+                    fprintf(out, "\"algorithm\": \"%s\", ", settingName(algorithms, countOf(algorithms), algorithm));
+                    fprintf(out, "\"depthComplexity\": \"%s\", ",
+                            algorithm == OpenCSG::Automatic || algorithm == AutoTune ? "Automatic" :
+                            settingName(depthComplexityAlgorithms, countOf(depthComplexityAlgorithms),
+                                        OpenCSG::getOption(OpenCSG::DepthComplexitySetting)));
+                    fprintf(out, "\"cameraOutside\": \"%s\", ",
+                            settingName(cameraOutsideOptimizations, countOf(cameraOutsideOptimizations),
+                                        OpenCSG::getOption(OpenCSG::CameraOutsideOptimization)));
+                    writeMeasurement(out, measurement);
+                    fprintf(out, "}");
+                    fflush(out);
+                    first = false;
+                }
+            }
+        }
+
+        for (std::vector<OpenCSG::Primitive*>::iterator itr = currentPrimitives.begin(); itr != currentPrimitives.end(); ++itr) {
+            delete *itr;
+        }
+        currentPrimitives.clear();
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (traceName && !recorder.write(traceName)) {
+        fprintf(stderr, "opencsgreplay: cannot write %s\n", traceName);
+    }
+    if (out != stdout)
+        fclose(out);
+
+    OpenCSG::freeResources();
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// shapes.cpp
+//
+// solid shapes of the example scenes for the benchmark, drawn without
+// GLUT since the benchmark has no window system
+//
+
+#include "shapes.h"
+#include "includeGl.h"
+#include <cmath>
+
+void solidSphere(double radius, int slices, int stacks) {
+    GLUquadricObj* quadric = gluNewQuadric();
+    gluSphere(quadric, radius, slices, stacks);
+    gluDeleteQuadric(quadric);
+}
+
+void solidCube(double size) {
+    static const GLfloat n[6][3] = {
+        {-1.0f,  0.0f,  0.0f}, { 0.0f,  1.0f,  0.0f}, { 1.0f,  0.0f,  0.0f},
+        { 0.0f, -1.0f,  0.0f}, { 0.0f,  0.0f,  1.0f}, { 0.0f,  0.0f, -1.0f}
+    };
+    static const GLint faces[6][4] = {
+        {0, 1, 2, 3}, {3, 2, 6, 7}, {7, 6, 5, 4},
+        {4, 5, 1, 0}, {5, 6, 2, 1}, {7, 4, 0, 3}
+    };
+    GLfloat v[8][3];
+    const GLfloat s = static_cast<GLfloat>(size) / 2.0f;
+    v[0][0] = v[1][0] = v[2][0] = v[3][0] = -s;
+    v[4][0] = v[5][0] = v[6][0] = v[7][0] =  s;
+    v[0][1] = v[1][1] = v[4][1] = v[5][1] = -s;
+    v[2][1] = v[3][1] = v[6][1] = v[7][1] =  s;
+    v[0][2] = v[3][2] = v[4][2] = v[7][2] = -s;
+    v[1][2] = v[2][2] = v[5][2] = v[6][2] =  s;
+
+    glBegin(GL_QUADS);
+    for (int i = 5; i >= 0; --i) {
+        glNormal3fv(n[i]);
+        for (int j = 0; j < 4; ++j) {
+            glVertex3fv(v[faces[i][j]]);
+        }
+    }
+    glEnd();
+}
+
+void solidTorus(double innerRadius, double outerRadius, int sides, int rings) {
+    const double pi = 3.14159265358979323846;
+    const double ringDelta = 2.0 * pi / rings;
+    const double sideDelta = 2.0 * pi / sides;
+
+    double theta = 0.0;
+    double cosTheta = 1.0;
+    double sinTheta = 0.0;
+    for (int i = 0; i < rings; ++i) {
+        const double theta1 = theta + ringDelta;
+        const double cosTheta1 = std::cos(theta1);
+        const double sinTheta1 = std::sin(theta1);
+        glBegin(GL_QUAD_STRIP);
+        double phi = 0.0;
+        for (int j = 0; j <= sides; ++j) {
+            phi += sideDelta;
+            const double cosPhi = std::cos(phi);
+            const double sinPhi = std::sin(phi);
+            const double dist = outerRadius + innerRadius * cosPhi;
+
+            glNormal3d(cosTheta1 * cosPhi, -sinTheta1 * cosPhi, sinPhi);
+            glVertex3d(cosTheta1 * dist, -sinTheta1 * dist, innerRadius * sinPhi);
+            glNormal3d(cosTheta * cosPhi, -sinTheta * cosPhi, sinPhi);
+            glVertex3d(cosTheta * dist, -sinTheta * dist, innerRadius * sinPhi);
+        }
+        glEnd();
+        theta = theta1;
+        cosTheta = cosTheta1;
+        sinTheta = sinTheta1;
+    }
+}
@@ -0,0 +1,294 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// thumbnailBench.cpp
+//
+// Measures the throughput of the ThumbnailService (see opencsgThumbnail.h)
+// with 1, 2, 4, ... up to the given number of workers. Each job is a box
+// intersected with a sphere and drilled by a varying number of holes,
+// seen from a varying direction. Writes the thumbnails per second for
+// each number of workers as JSON. With --tiled, a single image of the
+// given size is rendered in tiles with ThumbnailService::renderTiled()
+// instead, and the speedup and the parallel efficiency relative to one
+// worker are written as well. With Mesa llvmpipe, LP_NUM_THREADS=1
+// keeps the rasterizer threads of the workers from competing for the
+// cores.
+//
+// Usage: opencsgthumbnailbench [--jobs N] [--size N] [--workers N] [--output file]
+//                              [--tiled N] [--tile N]
+//
+
+#include <opencsgThumbnail.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+    const float pi = 3.14159265f;
+
+    void addVertex(OpenCSG::ThumbnailShape& shape, float x, float y, float z) {
+        shape.vertices.push_back(x);
+        shape.vertices.push_back(y);
+        shape.vertices.push_back(z);
+    }
+
+    void addQuad(OpenCSG::ThumbnailShape& shape, unsigned int a, unsigned int b, unsigned int c, unsigned int d) {
+        const unsigned int quad[6] = { a, b, c, a, c, d };
+        shape.indices.insert(shape.indices.end(), quad, quad + 6);
+    }
+
+    OpenCSG::ThumbnailShape box(float size) {
+        OpenCSG::ThumbnailShape shape;
+        for (int i = 0; i < 8; ++i) {
+            addVertex(shape, (i & 1) ? size : -size, (i & 2) ? size : -size, (i & 4) ? size : -size);
+        }
+        addQuad(shape, 0, 2, 3, 1);
+        addQuad(shape, 4, 5, 7, 6);
+        addQuad(shape, 0, 1, 5, 4);
+        addQuad(shape, 2, 6, 7, 3);
+        addQuad(shape, 0, 4, 6, 2);
+        addQuad(shape, 1, 3, 7, 5);
+        return shape;
+    }
+
+    OpenCSG::ThumbnailShape sphere(float radius, int slices, int stacks) {
+        OpenCSG::ThumbnailShape shape;
+        for (int t = 0; t <= stacks; ++t) {
+            const float theta = pi * static_cast<float>(t) / static_cast<float>(stacks);
+            for (int s = 0; s <= slices; ++s) {
+                const float phi = 2.0f * pi * static_cast<float>(s) / static_cast<float>(slices);
+                addVertex(shape, radius * std::sin(theta) * std::cos(phi), radius * std::cos(theta), radius * std::sin(theta) * std::sin(phi));
+            }
+        }
+        for (int t = 0; t < stacks; ++t) {
+            for (int s = 0; s < slices; ++s) {
+                const unsigned int a = t * (slices + 1) + s;
+                const unsigned int b = a + slices + 1;
+                addQuad(shape, a, a + 1, b + 1, b);
+            }
+        }
+        return shape;
+    }
+
+    /// a cylinder along the z axis through (x, y), longer than the box
+    OpenCSG::ThumbnailShape cylinder(float x, float y, float radius, int slices) {
+        OpenCSG::ThumbnailShape shape;
+        for (int s = 0; s < slices; ++s) {
+            const float phi = 2.0f * pi * static_cast<float>(s) / static_cast<float>(slices);
+            addVertex(shape, x + radius * std::cos(phi), y + radius * std::sin(phi), -2.0f);
+            addVertex(shape, x + radius * std::cos(phi), y + radius * std::sin(phi),  2.0f);
+        }
+        for (int s = 0; s < slices; ++s) {
+            const unsigned int n = (s + 1) % slices;
+            addQuad(shape, 2 * s, 2 * n, 2 * n + 1, 2 * s + 1);
+        }
+        // the caps as triangle fans
+        for (int s = 1; s + 1 < slices; ++s) {
+            const unsigned int bottom[3] = { 0, 2 * static_cast<unsigned int>(s) + 2, 2 * static_cast<unsigned int>(s) };
+            const unsigned int top[3] = { 1, 2 * static_cast<unsigned int>(s) + 1, 2 * static_cast<unsigned int>(s) + 3 };
+            shape.indices.insert(shape.indices.end(), bottom, bottom + 3);
+            shape.indices.insert(shape.indices.end(), top, top + 3);
+        }
+        return shape;
+    }
+
+    OpenCSG::ThumbnailJob makeJob(int index, int size) {
+        OpenCSG::ThumbnailJob job;
+        job.width = job.height = size;
+
+        OpenCSG::ThumbnailProduct product;
+        product.push_back(box(1.0f));
+        product.push_back(sphere(1.35f, 32, 16));
+        const int holes = 1 + index % 8;
+        for (int h = 0; h < holes; ++h) {
+            const float angle = 2.0f * pi * static_cast<float>(h) / static_cast<float>(holes);
+            product.push_back(cylinder(0.6f * std::cos(angle), 0.6f * std::sin(angle), 0.2f, 24));
+            product.back().operation = OpenCSG::Subtraction;
+            product.back().color[1] = product.back().color[2] = 0.3f;
+        }
+        job.products.push_back(product);
+
+        // rotated around the y and then the x axis, 5 units in front of the camera
+        const float a = 0.37f * static_cast<float>(index);
+        const float b = 0.5f + 0.2f * std::sin(0.11f * static_cast<float>(index));
+        const float ca = std::cos(a), sa = std::sin(a), cb = std::cos(b), sb = std::sin(b);
+        const float modelview[16] = { ca, sb * sa, -cb * sa, 0.0f,
+                                      0.0f, cb, sb, 0.0f,
+                                      sa, -sb * ca, cb * ca, 0.0f,
+                                      0.0f, 0.0f, -5.0f, 1.0f };
+        // perspective projection with a field of view of 40 degrees
+        const float n = 1.0f, f = 10.0f, t = 1.0f / std::tan(20.0f * pi / 180.0f);
+        const float projection[16] = { t, 0.0f, 0.0f, 0.0f,
+                                       0.0f, t, 0.0f, 0.0f,
+                                       0.0f, 0.0f, -(f + n) / (f - n), -1.0f,
+                                       0.0f, 0.0f, -2.0f * f * n / (f - n), 0.0f };
+        std::copy(modelview, modelview + 16, job.modelview);
+        std::copy(projection, projection + 16, job.projection);
+        return job;
+    }
+
+    std::size_t coveredPixels(const OpenCSG::ThumbnailImage& image) {
+        std::size_t covered = 0;
+        for (std::vector<float>::const_iterator depth = image.depth.begin(); depth != image.depth.end(); ++depth) {
+            if (*depth < 1.0f)
+                ++covered;
+        }
+        return covered;
+    }
+
+    double secondsNow() {
+        typedef std::chrono::steady_clock Clock;
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+    void usage() {
+        fprintf(stderr, "usage: opencsgthumbnailbench [--jobs N] [--size N] [--workers N] [--output file] [--tiled N] [--tile N]\n");
+    }
+
+} // unnamed namespace
+
+int main(int argc, char** argv)
+{
+    int jobCount = 200;
+    int size = 128;
+    int maxWorkers = static_cast<int>(std::thread::hardware_concurrency());
+    const char* outputName = 0;
+    int tiled = 0;
+    int tileSize = 512;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 < argc && std::strcmp(argv[i], "--jobs") == 0) {
+            jobCount = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--size") == 0) {
+            size = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--workers") == 0) {
+            maxWorkers = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--output") == 0) {
+            outputName = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--tiled") == 0) {
+            tiled = std::atoi(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--tile") == 0) {
+            tileSize = std::atoi(argv[++i]);
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (maxWorkers < 1)
+        maxWorkers = 1;
+    if (jobCount < 1 || size < 1 || tiled < 0 || tileSize < 1) {
+        usage();
+        return 1;
+    }
+
+    std::vector<OpenCSG::ThumbnailJob> jobs;
+    for (int j = 0; j < jobCount; ++j) {
+        jobs.push_back(makeJob(j, size));
+    }
+
+    FILE* out = stdout;
+    if (outputName) {
+        out = fopen(outputName, "w");
+        if (!out) {
+            fprintf(stderr, "opencsgthumbnailbench: cannot open %s\n", outputName);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    if (tiled) {
+        fprintf(out, "  \"tiled\": %d,\n", tiled);
+        fprintf(out, "  \"tile\": %d,\n", tileSize);
+    } else {
+        fprintf(out, "  \"size\": %d,\n", size);
+        fprintf(out, "  \"jobs\": %d,\n", jobCount);
+    }
+    fprintf(out, "  \"hardwareThreads\": %u,\n", std::thread::hardware_concurrency());
+    fprintf(out, "  \"results\": [");
+
+    bool first = true;
+    double singleWorkerSeconds = 0.0;
+    for (int workers = 1; ; workers = (std::min)(2 * workers, maxWorkers)) {
+        OpenCSG::ThumbnailService service(workers);
+        if (service.getWorkers() == 0) {
+            fprintf(stderr, "opencsgthumbnailbench: cannot create headless OpenGL contexts\n");
+            return 1;
+        }
+
+        // warm-up, which compiles the shaders and allocates the buffers
+        // of the workers, hopefully each of them
+        std::vector<std::future<OpenCSG::ThumbnailImage> > results;
+        for (unsigned int w = 0; w < 2 * service.getWorkers(); ++w) {
+            results.push_back(service.submit(jobs[w % jobs.size()]));
+        }
+        for (std::size_t r = 0; r < results.size(); ++r) {
+            results[r].wait();
+        }
+        results.clear();
+
+        if (tiled) {
+            OpenCSG::ThumbnailJob job = jobs.front();
+            job.width = job.height = tiled;
+            service.renderTiled(job, tileSize);
+
+            const double start = secondsNow();
+            const OpenCSG::ThumbnailImage image = service.renderTiled(job, tileSize);
+            const double seconds = secondsNow() - start;
+            if (workers == 1)
+                singleWorkerSeconds = seconds;
+            const double speedup = singleWorkerSeconds / seconds;
+
+            fprintf(out, "%s\n    {\"workers\": %u, \"seconds\": %.4f, \"speedup\": %.3f, \"efficiency\": %.3f, \"coveredPixels\": %lu}",
+                    first ? "" : ",", service.getWorkers(), seconds, speedup, speedup / service.getWorkers(),
+                    static_cast<unsigned long>(coveredPixels(image)));
+        } else {
+            const double start = secondsNow();
+            for (std::vector<OpenCSG::ThumbnailJob>::const_iterator itr = jobs.begin(); itr != jobs.end(); ++itr) {
+                results.push_back(service.submit(*itr));
+            }
+            // the covered pixels of all thumbnails, as check that they are rendered
+            std::size_t covered = 0;
+            for (std::size_t r = 0; r < results.size(); ++r) {
+                covered += coveredPixels(results[r].get());
+            }
+            const double seconds = secondsNow() - start;
+
+            fprintf(out, "%s\n    {\"workers\": %u, \"seconds\": %.4f, \"thumbnailsPerSecond\": %.2f, \"coveredPixels\": %lu}",
+                    first ? "" : ",", service.getWorkers(), seconds, static_cast<double>(jobCount) / seconds,
+                    static_cast<unsigned long>(covered));
+        }
+        fflush(out);
+        first = false;
+
+        if (workers == maxWorkers)
+            break;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -27,7 +27,16 @@
 #ifndef __OpenCSG__include_gl_h__
 #define __OpenCSG__include_gl_h__
 
+#ifdef OPENCSG_EXAMPLE_NO_GLUT
+// for the scenes in the benchmark, which runs without GLUT
 #ifdef __APPLE__
+#include <OpenGL/gl.h>
+#include <OpenGL/glu.h>
+#else
+#include <GL/gl.h>
+#include <GL/glu.h>
+#endif
+#elif defined(__APPLE__)
 #include <GLUT/glut.h>
 #elif  _WIN32
 // glut include under windows, assuming that freeglut binary has been
@@ -23,7 +23,7 @@
 //
 
 #include <opencsg.h>
-#include "displaylistPrimitive.h"
+#include "scenes.h"
 #include <algorithm>
 #include <iostream>
 #include <sstream>
@@ -45,18 +45,11 @@ enum {
     GLSL_FIXED_FUNCTION, GLSL_FTRANSFORM, GLSL_MVP_COMBINED, GLSL_MVP_SEPARATE
 };
 
-std::vector<OpenCSG::Primitive*> primitives;
-std::vector<OpenCSG::Primitive*> primitives2;
-std::vector<OpenCSG::Primitive*> primitives3;
-
-
 bool               spin = true;
 bool               inside = false;
 float              rot = 0.0f;
 std::ostringstream fpsStream;
 
-std::vector<GLuint> displaylistGarbagePile;
-
 bool               benchmode = false;
 bool               benchSettingFrameOne = false;
 bool               skipCubeRack = false;
@@ -64,339 +57,6 @@ int                benchShape = BENCH_START;
 int                benchAlgorithm = GF_STANDARD;
 int                benchPerfOption = CAM_OUTSIDE_DEFAULT;
 
-void clearPrimitives(std::vector<OpenCSG::Primitive*> & p)
-{
-    for (std::vector<OpenCSG::Primitive*>::const_iterator it = p.begin(); it != p.end(); ++it)
-    {
-        OpenCSG::DisplayListPrimitive* primitive = static_cast<OpenCSG::DisplayListPrimitive*>(*it);
-        GLuint id = primitive->getDisplayListId();
-        if (std::find(displaylistGarbagePile.begin(), displaylistGarbagePile.end(), id) == displaylistGarbagePile.end())
-        {
-            glDeleteLists(1, id);
-            displaylistGarbagePile.push_back(id);
-        }
-        delete primitive;
-    }
-
-    p.clear();
-}
-
-void clearPrimitives()
-{
-    displaylistGarbagePile.clear();
-    clearPrimitives(primitives);
-    clearPrimitives(primitives2);
-    clearPrimitives(primitives3);
-    displaylistGarbagePile.clear();
-}
-
-void solidCylinder(GLdouble radius, GLdouble height, GLint slices, GLint stacks) {
-
-    GLUquadricObj* qobj = gluNewQuadric();
-
-    gluCylinder(qobj, radius, radius, height, slices, stacks);
-    glScalef(-1.0f, 1.0f, -1.0f);
-    gluDisk(qobj, 0.0, radius, slices, stacks);
-    glScalef(-1.0f, 1.0f, -1.0f);
-    glTranslatef(0.0f, 0.0f, static_cast<GLfloat>(height));
-    gluDisk(qobj, 0.0, radius, slices, stacks);
-
-    gluDeleteQuadric(qobj);    
-}
-
-void setBasicShape() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(-0.25f, 0.0f, 0.0f);
-    glutSolidSphere(1.0, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id2 = glGenLists(1);
-    glNewList(id2, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(0.25f, 0.0f, 0.0f);
-    glutSolidSphere(1.0, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id3 = glGenLists(1);
-    glNewList(id3, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(0.0f, 0.0f, 0.5f);
-    glScalef(0.5f, 0.5f, 2.0f);
-    glutSolidSphere(1.0, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Intersection, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1));
-}
-
-void setWidget() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glutSolidSphere(1.2, 20, 20);
-    glEndList();
-
-    GLuint id2 = glGenLists(1);
-    glNewList(id2, GL_COMPILE);
-    glutSolidCube(1.8);
-    glEndList();
-
-    GLuint id3 = glGenLists(1);
-    glNewList(id3, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(0.0f, 0.0f, -1.25f);
-    solidCylinder(0.6, 2.5, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id4 = glGenLists(1);
-    glNewList(id4, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -1.25f);
-    solidCylinder(0.6, 2.5, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id5 = glGenLists(1);
-    glNewList(id5, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -1.25f);
-    solidCylinder(0.6, 2.5, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Intersection, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id5, OpenCSG::Subtraction, 1));
-}
-
-void setGrid2D() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glPushMatrix();
-    glScalef(1.0f, 0.2f, 1.0f);
-    glTranslatef(0.0f, -1.25f, 0.0f);
-    glutSolidCube(2.5);
-    glPopMatrix();
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-
-    for (int x=-2; x<=2; ++x) {
-        for (int z=-2; z<=2; ++z) {
-            GLuint id = glGenLists(1);
-            glNewList(id, GL_COMPILE);
-            glPushMatrix();
-            glTranslatef(x*0.5f, 0.0f, z*0.5f);
-            glutSolidSphere(0.22, 15, 15);
-            glPopMatrix();
-            glEndList();
-
-            primitives.push_back(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1));
-        }
-    }
-}
-
-void setGrid3D() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glutSolidCube(2.0);
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-
-    for (int x=-1; x<=1; ++x) {
-        for (int y=-1; y<=1; ++y) {
-            for (int z=-1; z<=1; ++z) {
-                GLuint id = glGenLists(1);
-                glNewList(id, GL_COMPILE);
-                glPushMatrix();
-                glTranslatef(static_cast<GLfloat>(x), static_cast<GLfloat>(y), static_cast<GLfloat>(z));
-                glutSolidSphere(0.58, 20, 20);
-                glPopMatrix();
-                glEndList();
-
-                primitives.push_back(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1));
-            }
-        }
-    }
-}
-
-void setCubeRack() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glutSolidCube(2.0);
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-
-    // mx*x / my*y / mz*z loop all numbers in [-3, 3] in the following order:
-    // 3, -3, 2, -2, 1, -1, 0. Compared to the trivial ordering, this makes
-    // the CSG rendering less depending on the camera orientation.
-    for (int x=3; x>=0; --x) {
-        for (int y=3; y>=0; --y) {
-            for (int z=3; z>=0; --z) {
-                for (int mx=-1; mx<=1 && mx<=x; mx+=2) {
-                    for (int my=-1; my<=1 && my<=y; my+=2) {
-                        for (int mz=-1; mz<=1 && mz<=z; mz+=2) {
-                            GLuint id = glGenLists(1);
-                            glNewList(id, GL_COMPILE);
-                            glPushMatrix();
-                            glTranslatef(float(x*mx)/6.0f, float(y*my)/6.0f, float(z*mz)/6.0f);
-                            glutSolidSphere(0.58, 20, 20);
-                            glPopMatrix();
-                            glEndList();
-
-                            primitives.push_back(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1));
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
-void setPipe() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(0.0f, 0.0f, -2.5f);
-    solidCylinder(0.6, 2.5, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id2 = glGenLists(1);
-    glNewList(id2, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(0.0f, 0.0f, -2.51f);
-    solidCylinder(0.5, 2.52, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id3 = glGenLists(1);
-    glNewList(id3, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -2.5f);
-    solidCylinder(0.6, 2.5, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id4 = glGenLists(1);
-    glNewList(id4, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -2.51f);
-    solidCylinder(0.5, 2.52, 20, 20);
-    glPopMatrix();
-    glEndList();
-
-    GLuint id5 = glGenLists(1);
-    glNewList(id5, GL_COMPILE);
-    glutSolidSphere(0.6, 20, 20);
-    glEndList();
-
-    GLuint id6 = glGenLists(1);
-    glNewList(id6, GL_COMPILE);
-    glutSolidSphere(0.5, 20, 20);
-    glEndList();
-
-    GLuint id7 = glGenLists(1);
-    glNewList(id7, GL_COMPILE);
-    glPushMatrix();
-    glTranslatef(-0.8f, 1.0f, -0.8f);
-    glutSolidCube(2.0);
-    glPopMatrix();
-    glEndList();
-
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1));
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1));
-
-    primitives2.push_back(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Intersection, 1));
-    primitives2.push_back(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1));
-    primitives2.push_back(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1));
-    primitives2.push_back(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1));
-
-    primitives3.push_back(new OpenCSG::DisplayListPrimitive(id5, OpenCSG::Intersection, 1));
-    primitives3.push_back(new OpenCSG::DisplayListPrimitive(id6, OpenCSG::Subtraction, 1));
-    primitives3.push_back(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1));
-    primitives3.push_back(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1));
-    primitives3.push_back(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1));
-}
-
-void setConcave() {
-
-    clearPrimitives();
-
-    GLuint id1 = glGenLists(1);
-    glNewList(id1, GL_COMPILE);
-    glutSolidTorus(0.6, 1.0, 25, 25);
-    glEndList();
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 2));
-
-    for (unsigned int i=0; i<4; ++i) {
-        GLuint id = glGenLists(1);
-        glNewList(id, GL_COMPILE);
-        glPushMatrix();
-        glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
-        glRotatef(i*90.0f + 45.0f, 1.0f, 0.0f, 0.0f);
-        glTranslatef(0.0f, 1.0f, 0.0f);
-        glutSolidTorus(0.3, 0.6, 15, 15);
-        glPopMatrix();
-        glEndList();
-        primitives.push_back(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 2));
-    }
-
-    GLuint id3 = glGenLists(1);
-    glNewList(id3, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -1.65f);
-    solidCylinder(0.3, 3.3, 20, 20);
-    glPopMatrix();
-    glEndList();
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1));
-
-    GLuint id4 = glGenLists(1);
-    glNewList(id4, GL_COMPILE);
-    glPushMatrix();
-    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-    glTranslatef(0.0f, 0.0f, -1.65f);
-    solidCylinder(0.3, 3.3, 20, 20);
-    glPopMatrix();
-    glEndList();
-    primitives.push_back(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1));
-}
-
 void renderfps() {
     glDisable(GL_DEPTH_TEST);
     glLoadIdentity();
@@ -718,6 +378,10 @@ void key(unsigned char k, int, int) {
         nextBenchSetting();
         fpsStream.str("");
         break;
+    case 'c':
+        // for replaying the model with opencsgreplay
+        OpenCSG::captureNextRender("opencsg.capture");
+        break;
     default:
         break;
     }
@@ -0,0 +1,384 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// scenes.cpp
+//
+// the CSG shapes of the example program, also used by the benchmark
+//
+
+#include "scenes.h"
+#include "displaylistPrimitive.h"
+#include "shapes.h"
+#include <algorithm>
+#include <cmath>
+
+#include "includeGl.h"
+
+std::vector<OpenCSG::Primitive*> primitives;
+std::vector<OpenCSG::Primitive*> primitives2;
+std::vector<OpenCSG::Primitive*> primitives3;
+
+std::vector<GLuint> displaylistGarbagePile;
+
+void clearPrimitives(std::vector<OpenCSG::Primitive*> & p)
+{
+    for (std::vector<OpenCSG::Primitive*>::const_iterator it = p.begin(); it != p.end(); ++it)
+    {
+        OpenCSG::DisplayListPrimitive* primitive = static_cast<OpenCSG::DisplayListPrimitive*>(*it);
+        GLuint id = primitive->getDisplayListId();
+        if (std::find(displaylistGarbagePile.begin(), displaylistGarbagePile.end(), id) == displaylistGarbagePile.end())
+        {
+            glDeleteLists(1, id);
+            displaylistGarbagePile.push_back(id);
+        }
+        delete primitive;
+    }
+
+    p.clear();
+}
+
+void clearPrimitives()
+{
+    displaylistGarbagePile.clear();
+    clearPrimitives(primitives);
+    clearPrimitives(primitives2);
+    clearPrimitives(primitives3);
+    displaylistGarbagePile.clear();
+}
+
+// sets the object bounding box of the primitive, given by its center and
+// half extents. This lets OpenCSG skip work for primitives that do not
+// overlap and base the Automatic algorithm choice on the actual layout.
+OpenCSG::Primitive* withBox(OpenCSG::Primitive* primitive,
+                            float cx, float cy, float cz,
+                            float rx, float ry, float rz)
+{
+    primitive->setObjectBoundingBox(cx - rx, cy - ry, cz - rz, cx + rx, cy + ry, cz + rz);
+    return primitive;
+}
+void solidCylinder(GLdouble radius, GLdouble height, GLint slices, GLint stacks) {
+
+    GLUquadricObj* qobj = gluNewQuadric();
+
+    gluCylinder(qobj, radius, radius, height, slices, stacks);
+    glScalef(-1.0f, 1.0f, -1.0f);
+    gluDisk(qobj, 0.0, radius, slices, stacks);
+    glScalef(-1.0f, 1.0f, -1.0f);
+    glTranslatef(0.0f, 0.0f, static_cast<GLfloat>(height));
+    gluDisk(qobj, 0.0, radius, slices, stacks);
+
+    gluDeleteQuadric(qobj);    
+}
+
+void setBasicShape() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(-0.25f, 0.0f, 0.0f);
+    solidSphere(1.0, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id2 = glGenLists(1);
+    glNewList(id2, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(0.25f, 0.0f, 0.0f);
+    solidSphere(1.0, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id3 = glGenLists(1);
+    glNewList(id3, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(0.0f, 0.0f, 0.5f);
+    glScalef(0.5f, 0.5f, 2.0f);
+    solidSphere(1.0, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), -0.25f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Intersection, 1),  0.25f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1),   0.0f, 0.0f, 0.5f, 0.5f, 0.5f, 2.0f));
+}
+
+void setWidget() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    solidSphere(1.2, 20, 20);
+    glEndList();
+
+    GLuint id2 = glGenLists(1);
+    glNewList(id2, GL_COMPILE);
+    solidCube(1.8);
+    glEndList();
+
+    GLuint id3 = glGenLists(1);
+    glNewList(id3, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(0.0f, 0.0f, -1.25f);
+    solidCylinder(0.6, 2.5, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id4 = glGenLists(1);
+    glNewList(id4, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -1.25f);
+    solidCylinder(0.6, 2.5, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id5 = glGenLists(1);
+    glNewList(id5, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -1.25f);
+    solidCylinder(0.6, 2.5, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), 0.0f, 0.0f, 0.0f, 1.2f,  1.2f,  1.2f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Intersection, 1), 0.0f, 0.0f, 0.0f, 0.9f,  0.9f,  0.9f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1),  0.0f, 0.0f, 0.0f, 0.6f,  0.6f,  1.25f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1),  0.0f, 0.0f, 0.0f, 1.25f, 0.6f,  0.6f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id5, OpenCSG::Subtraction, 1),  0.0f, 0.0f, 0.0f, 0.6f,  1.25f, 0.6f));
+}
+
+void setGrid2D() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    glPushMatrix();
+    glScalef(1.0f, 0.2f, 1.0f);
+    glTranslatef(0.0f, -1.25f, 0.0f);
+    solidCube(2.5);
+    glPopMatrix();
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), 0.0f, -0.25f, 0.0f, 1.25f, 0.25f, 1.25f));
+
+    for (int x=-2; x<=2; ++x) {
+        for (int z=-2; z<=2; ++z) {
+            GLuint id = glGenLists(1);
+            glNewList(id, GL_COMPILE);
+            glPushMatrix();
+            glTranslatef(x*0.5f, 0.0f, z*0.5f);
+            solidSphere(0.22, 15, 15);
+            glPopMatrix();
+            glEndList();
+
+            primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1), x*0.5f, 0.0f, z*0.5f, 0.22f, 0.22f, 0.22f));
+        }
+    }
+}
+
+void setGrid3D() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    solidCube(2.0);
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f));
+
+    for (int x=-1; x<=1; ++x) {
+        for (int y=-1; y<=1; ++y) {
+            for (int z=-1; z<=1; ++z) {
+                GLuint id = glGenLists(1);
+                glNewList(id, GL_COMPILE);
+                glPushMatrix();
+                glTranslatef(static_cast<GLfloat>(x), static_cast<GLfloat>(y), static_cast<GLfloat>(z));
+                solidSphere(0.58, 20, 20);
+                glPopMatrix();
+                glEndList();
+
+                primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1),
+                                             static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), 0.58f, 0.58f, 0.58f));
+            }
+        }
+    }
+}
+
+void setCubeRack() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    solidCube(2.0);
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f));
+
+    // mx*x / my*y / mz*z loop all numbers in [-3, 3] in the following order:
+    // 3, -3, 2, -2, 1, -1, 0. Compared to the trivial ordering, this makes
+    // the CSG rendering less depending on the camera orientation.
+    for (int x=3; x>=0; --x) {
+        for (int y=3; y>=0; --y) {
+            for (int z=3; z>=0; --z) {
+                for (int mx=-1; mx<=1 && mx<=x; mx+=2) {
+                    for (int my=-1; my<=1 && my<=y; my+=2) {
+                        for (int mz=-1; mz<=1 && mz<=z; mz+=2) {
+                            GLuint id = glGenLists(1);
+                            glNewList(id, GL_COMPILE);
+                            glPushMatrix();
+                            glTranslatef(float(x*mx)/6.0f, float(y*my)/6.0f, float(z*mz)/6.0f);
+                            solidSphere(0.58, 20, 20);
+                            glPopMatrix();
+                            glEndList();
+
+                            primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 1),
+                                                         float(x*mx)/6.0f, float(y*my)/6.0f, float(z*mz)/6.0f, 0.58f, 0.58f, 0.58f));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void setPipe() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(0.0f, 0.0f, -2.5f);
+    solidCylinder(0.6, 2.5, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id2 = glGenLists(1);
+    glNewList(id2, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(0.0f, 0.0f, -2.51f);
+    solidCylinder(0.5, 2.52, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id3 = glGenLists(1);
+    glNewList(id3, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -2.5f);
+    solidCylinder(0.6, 2.5, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id4 = glGenLists(1);
+    glNewList(id4, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -2.51f);
+    solidCylinder(0.5, 2.52, 20, 20);
+    glPopMatrix();
+    glEndList();
+
+    GLuint id5 = glGenLists(1);
+    glNewList(id5, GL_COMPILE);
+    solidSphere(0.6, 20, 20);
+    glEndList();
+
+    GLuint id6 = glGenLists(1);
+    glNewList(id6, GL_COMPILE);
+    solidSphere(0.5, 20, 20);
+    glEndList();
+
+    GLuint id7 = glGenLists(1);
+    glNewList(id7, GL_COMPILE);
+    glPushMatrix();
+    glTranslatef(-0.8f, 1.0f, -0.8f);
+    solidCube(2.0);
+    glPopMatrix();
+    glEndList();
+
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 1), 0.0f, 0.0f, -1.25f, 0.6f, 0.6f, 1.25f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1), 0.0f, 0.0f, -1.25f, 0.5f, 0.5f, 1.26f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1), -1.25f, 0.0f, 0.0f, 1.26f, 0.5f, 0.5f));
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1), -0.8f, 1.0f, -0.8f, 1.0f, 1.0f, 1.0f));
+
+    primitives2.push_back(withBox(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Intersection, 1), -1.25f, 0.0f, 0.0f, 1.25f, 0.6f, 0.6f));
+    primitives2.push_back(withBox(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1), 0.0f, 0.0f, -1.25f, 0.5f, 0.5f, 1.26f));
+    primitives2.push_back(withBox(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1), -1.25f, 0.0f, 0.0f, 1.26f, 0.5f, 0.5f));
+    primitives2.push_back(withBox(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1), -0.8f, 1.0f, -0.8f, 1.0f, 1.0f, 1.0f));
+
+    primitives3.push_back(withBox(new OpenCSG::DisplayListPrimitive(id5, OpenCSG::Intersection, 1), 0.0f, 0.0f, 0.0f, 0.6f, 0.6f, 0.6f));
+    primitives3.push_back(withBox(new OpenCSG::DisplayListPrimitive(id6, OpenCSG::Subtraction, 1), 0.0f, 0.0f, 0.0f, 0.5f, 0.5f, 0.5f));
+    primitives3.push_back(withBox(new OpenCSG::DisplayListPrimitive(id2, OpenCSG::Subtraction, 1), 0.0f, 0.0f, -1.25f, 0.5f, 0.5f, 1.26f));
+    primitives3.push_back(withBox(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1), -1.25f, 0.0f, 0.0f, 1.26f, 0.5f, 0.5f));
+    primitives3.push_back(withBox(new OpenCSG::DisplayListPrimitive(id7, OpenCSG::Subtraction, 1), -0.8f, 1.0f, -0.8f, 1.0f, 1.0f, 1.0f));
+}
+
+void setConcave() {
+
+    clearPrimitives();
+
+    GLuint id1 = glGenLists(1);
+    glNewList(id1, GL_COMPILE);
+    solidTorus(0.6, 1.0, 25, 25);
+    glEndList();
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id1, OpenCSG::Intersection, 2), 0.0f, 0.0f, 0.0f, 1.6f, 1.6f, 0.6f));
+
+    for (unsigned int i=0; i<4; ++i) {
+        GLuint id = glGenLists(1);
+        glNewList(id, GL_COMPILE);
+        glPushMatrix();
+        glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
+        glRotatef(i*90.0f + 45.0f, 1.0f, 0.0f, 0.0f);
+        glTranslatef(0.0f, 1.0f, 0.0f);
+        solidTorus(0.3, 0.6, 15, 15);
+        glPopMatrix();
+        glEndList();
+        // the rotations move the center of the torus to (sin a, cos a, 0)
+        const float a = (i*90.0f + 45.0f) * 3.14159265f / 180.0f;
+        primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id, OpenCSG::Subtraction, 2), std::sin(a), std::cos(a), 0.0f, 0.9f, 0.9f, 0.9f));
+    }
+
+    GLuint id3 = glGenLists(1);
+    glNewList(id3, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 0.0f, 1.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -1.65f);
+    solidCylinder(0.3, 3.3, 20, 20);
+    glPopMatrix();
+    glEndList();
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id3, OpenCSG::Subtraction, 1), 0.0f, 0.0f, 0.0f, 1.65f, 0.3f, 0.3f));
+
+    GLuint id4 = glGenLists(1);
+    glNewList(id4, GL_COMPILE);
+    glPushMatrix();
+    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
+    glTranslatef(0.0f, 0.0f, -1.65f);
+    solidCylinder(0.3, 3.3, 20, 20);
+    glPopMatrix();
+    glEndList();
+    primitives.push_back(withBox(new OpenCSG::DisplayListPrimitive(id4, OpenCSG::Subtraction, 1), 0.0f, 0.0f, 0.0f, 0.3f, 1.65f, 0.3f));
+}
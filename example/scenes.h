@@ -0,0 +1,47 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// scenes.h
+//
+// the CSG shapes of the example program. Each function replaces the
+// content of the primitive arrays, which are rendered one after the other.
+//
+
+#ifndef __OpenCSG__scenes_h__
+#define __OpenCSG__scenes_h__
+
+#include <opencsg.h>
+#include <vector>
+
+extern std::vector<OpenCSG::Primitive*> primitives;
+extern std::vector<OpenCSG::Primitive*> primitives2;
+extern std::vector<OpenCSG::Primitive*> primitives3;
+
+/// deletes all primitives and their display lists
+void clearPrimitives();
+
+void setBasicShape();
+void setWidget();
+void setGrid2D();
+void setGrid3D();
+void setCubeRack();
+void setPipe();
+void setConcave();
+
+#endif
@@ -0,0 +1,34 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// shapes.h
+//
+// solid shapes as known from GLUT, used by the scenes. The example program
+// implements them with GLUT in shapes.cpp. The benchmark, which runs
+// without a window system, has its own implementation.
+//
+
+#ifndef __OpenCSG__shapes_h__
+#define __OpenCSG__shapes_h__
+
+void solidSphere(double radius, int slices, int stacks);
+void solidCube(double size);
+void solidTorus(double innerRadius, double outerRadius, int sides, int rings);
+
+#endif
@@ -25,6 +25,7 @@
 #ifndef __OpenCSG__opencsg_h__
 #define __OpenCSG__opencsg_h__
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -73,6 +74,46 @@ namespace OpenCSG {
         void getBoundingBox(float& minx, float& miny, float& minz,
                             float& maxx, float& maxy, float& maxz) const;
 
+        /// Sets the bounding box in object coordinates, optionally with a
+        /// transformation (16 floats in column-major order, applied before
+        /// the modelview matrix). When set, OpenCSG computes the bounding
+        /// box in normalized device coordinates from it at the beginning of
+        /// render(), using the current modelview and projection matrices,
+        /// so setBoundingBox() need not be called on every camera change.
+        /// The computed box replaces the one set with setBoundingBox(). Its
+        /// z range is given as depth values in [0, 1] (i.e., for the default
+        /// glDepthRange()), as used by the DepthBoundsOptimization.
+        void setObjectBoundingBox(float  minx, float  miny, float  minz,
+                                  float  maxx, float  maxy, float  maxz,
+                                  const float* transform = 0);
+        /// Removes the bounding box in object coordinates.
+        void clearObjectBoundingBox();
+        /// Returns false if no bounding box in object coordinates is set.
+        /// Else, returns the bounding box and its transformation, which is
+        /// the identity if none has been set.
+        bool getObjectBoundingBox(float& minx, float& miny, float& minz,
+                                  float& maxx, float& maxy, float& maxz,
+                                  float transform[16]) const;
+
+        /// Sets points in object coordinates whose convex hull contains the
+        /// primitive, such as the vertices of a convex primitive or of a
+        /// k-DOP enclosing it, optionally with a transformation as for
+        /// setObjectBoundingBox(). The count points are given as x, y, z
+        /// triples and are copied. At the beginning of render(), OpenCSG
+        /// projects the points to compute a bounding box, which is tighter
+        /// than the projected object bounding box for rotated or elongated
+        /// primitives. Hull points take precedence over the object bounding
+        /// box. Keep the number of points small, as they are transformed
+        /// in each call of render().
+        void setHullPoints(const float* points, unsigned int count,
+                           const float* transform = 0);
+        /// Removes the hull points.
+        void clearHullPoints();
+        /// Returns the hull points and sets count to their number, or
+        /// returns 0 if no hull points are set. transform is set to the
+        /// transformation of the points, or the identity if none was set.
+        const float* getHullPoints(unsigned int& count, float transform[16]) const;
+
         /// render() is the abstract render method, to be implemented in
         /// derived classes. In the implementation, be sure not to alter
         /// the modelview or projection (glPushMatrix/glPopMatrix might be
@@ -88,6 +129,109 @@ namespace OpenCSG {
         float mMinx, mMiny, mMinz, mMaxx, mMaxy, mMaxz;
     };
 
+    /// A primitive whose geometry is stored in OpenGL buffer objects.
+    /// The geometry is a range of an indexed triangle list, given by a
+    /// vertex array object that has the vertex positions and the element
+    /// array buffer (with unsigned int indices) bound. Vertex positions
+    /// must be sourced by glVertexPointer() for the fixed function
+    /// pipeline, and/or by the generic vertex attribute 0 for a vertex
+    /// shader. Many BufferPrimitives may share the same vertex array
+    /// object: OpenCSG then draws all primitives of a batch that share it
+    /// with a single call of glMultiDrawElementsBaseVertex(), instead of
+    /// invoking render() for each of them. Requires OpenGL 3.2.
+    class BufferPrimitive : public Primitive {
+    public:
+        /// firstIndex and count specify the range of indices in the element
+        /// array buffer, baseVertex is added to each index.
+        BufferPrimitive(Operation, unsigned int convexity,
+                        unsigned int vertexArray, unsigned int firstIndex,
+                        unsigned int count, int baseVertex = 0);
+
+        /// Returns the vertex array object.
+        unsigned int getVertexArray() const;
+        /// Returns the first index in the element array buffer.
+        unsigned int getFirstIndex() const;
+        /// Returns the number of indices.
+        unsigned int getCount() const;
+        /// Returns the value added to each index.
+        int getBaseVertex() const;
+
+        /// Binds the vertex array object and draws the range of triangles.
+        virtual void render();
+
+    private:
+        unsigned int mVertexArray;
+        unsigned int mFirstIndex;
+        unsigned int mCount;
+        int mBaseVertex;
+    };
+
+    class InstanceList;
+
+    /// A primitive that renders the same geometry, given as for
+    /// BufferPrimitive, many times with different transformations, for
+    /// example a pattern of drill holes. Each instance has a transformation
+    /// matrix, which is applied before the modelview matrix, and its own
+    /// bounding box in normalized device coordinates (see
+    /// Primitive::setBoundingBox()). The bounding box of the
+    /// InstancedPrimitive itself is not used. However, a bounding box in
+    /// object coordinates or hull points (see Primitive::setObjectBoundingBox()
+    /// and Primitive::setHullPoints()) apply to each instance, with the
+    /// transformation of the instance.
+    ///
+    /// In render(), OpenCSG handles each instance as a primitive of its own,
+    /// so instances that do not overlap are processed in the same batch.
+    /// In a core profile context, the instances of a batch are drawn with
+    /// a single call of glDrawElementsInstancedBaseVertex(), and the vertex
+    /// shader reads the transformation of the instance from the generic
+    /// vertex attributes 12 to 15 (see setVertexShader()). Hence, these
+    /// attributes must not be used by the vertex array object. This also
+    /// holds for the passes of the SCS algorithm that render an ID per
+    /// primitive, where the default vertex shader derives the ID of each
+    /// instance from gl_InstanceID. With a vertex shader set by the user,
+    /// these passes draw the instances one after the other. In a
+    /// compatibility context, the instances are always drawn one after the
+    /// other, with the transformation multiplied onto the modelview matrix.
+    class InstancedPrimitive : public BufferPrimitive {
+    public:
+        InstancedPrimitive(Operation, unsigned int convexity,
+                           unsigned int vertexArray, unsigned int firstIndex,
+                           unsigned int count, int baseVertex = 0);
+        InstancedPrimitive(const InstancedPrimitive&);
+        InstancedPrimitive& operator=(const InstancedPrimitive&);
+        virtual ~InstancedPrimitive();
+
+        /// Adds an instance. The transformation is given as 16 floats in
+        /// column-major order (as for glMultMatrixf()).
+        void addInstance(const float transform[16],
+                         float minx = -1.0f, float miny = -1.0f, float minz = -1.0f,
+                         float maxx =  1.0f, float maxy =  1.0f, float maxz =  1.0f);
+        /// Removes all instances.
+        void clearInstances();
+        /// Returns the number of instances.
+        unsigned int getInstanceCount() const;
+        /// Returns the transformation of the instance.
+        const float* getInstanceTransform(unsigned int instance) const;
+        /// Returns the bounding box of the instance.
+        void getInstanceBoundingBox(unsigned int instance,
+                                    float& minx, float& miny, float& minz,
+                                    float& maxx, float& maxy, float& maxz) const;
+
+        /// Draws a single instance.
+        void renderInstance(unsigned int instance);
+        /// Draws all instances.
+        virtual void render();
+
+    private:
+        friend class InstanceExpansion;
+
+        std::vector<float> mTransforms;
+        std::vector<float> mBoundingBoxes;
+        // the instances as handled by the CSG algorithms, created by
+        // render() and kept until the instances change
+        InstanceList* mInstances;
+    };
+
     /// The function render() performs CSG rendering. The function initializes 
     /// the z-buffer with the z-values of the CSG product given as array of 
     /// primitives. It does not alter the color buffer, so you have to shade
@@ -114,6 +258,31 @@ namespace OpenCSG {
     /// directly. 
     void render(const std::vector<Primitive*>& primitives);
 
+    /// Renders the CSG product as render() does, but stops once about the
+    /// given number of milliseconds have been spent, such that the frame
+    /// rate stays interactive for products that are expensive to render.
+    /// The partial result is merged into the z-buffer, and the next call
+    /// with the same array of primitives continues where this one stopped.
+    /// Returns true once the image has converged, i.e., the z-buffer holds
+    /// the same result as after render(). The partial results of SCS
+    /// show subtracted primitives that have not been processed yet as
+    /// not subtracted, those of Goldfeather lack some parts of the product.
+    ///
+    /// The progress is kept for each array of primitives (for a few of
+    /// them) and discarded if the settings, the modelview or projection
+    /// matrix, the viewport, the scissor box, the vertex shader, or the
+    /// operation, convexity or bounding box of any primitive change.
+    /// Other changes of the primitives are not detected; freeResources()
+    /// discards the progress. The z-buffer should be cleared before each
+    /// call, as usual. The time is measured with fence sync objects after
+    /// each step of the algorithm (an iteration of the SCS subtraction, or
+    /// a layer of Goldfeather), and one step is kept in flight, so the
+    /// budget may be exceeded by about one step. The call does not wait
+    /// for a step beyond the budget, though. At least one step is
+    /// rendered per call. The AutoTuneSetting is ignored. Requires OpenGL
+    /// 3.2; without it, render() is called and true is returned.
+    bool renderProgressive(const std::vector<Primitive*>& primitives, double milliseconds);
+
     /// Sets a vertex shader that is used by OpenCSG for transforming the
     /// geometry. By default, or when an empty vertex shader is set, OpenCSG
     /// uses the fixed function pipeline. When setting a non-empty vertex
@@ -132,8 +301,70 @@ namespace OpenCSG {
     /// Important is that the shader should transform the vertices in
     /// exactly the same way as later, when the geometry is shaded
     /// using the GL_EQUAL depth function.
+    ///
+    /// If the current OpenGL context is a core profile context, OpenCSG
+    /// automatically uses GLSL for all of its internal rendering. In this
+    /// case, the vertex shader must be written for the core profile, with
+    /// the vertex position at attribute location 0. The modelview and the
+    /// projection matrix, as set with setMatrices() below, are provided in
+    /// the uniform block OpenCSGMatrices:
+    /**
+            #version 330 core
+            layout(std140) uniform OpenCSGMatrices {
+                mat4 modelViewMatrix;
+                mat4 projectionMatrix;
+            };
+            layout(location = 0) in vec4 position;
+            void main() {
+                gl_Position = projectionMatrix * modelViewMatrix * position;
+            }
+    **/
+    /// This is also the vertex shader that is used in a core profile
+    /// context if no vertex shader is set, except that the default shader
+    /// additionally applies the transformation of an InstancedPrimitive:
+    /**
+            layout(location = 12) in mat4 instanceMatrix;
+            ...
+                gl_Position = projectionMatrix * modelViewMatrix * instanceMatrix * position;
+    **/
+    /// For all other primitives, OpenCSG sets instanceMatrix to the
+    /// identity matrix.
+    ///
+    /// If the driver supports GL_KHR_parallel_shader_compile, the shader
+    /// programs for a new vertex shader are built in the background. In a
+    /// compatibility context, render() merges the result with the fixed
+    /// function pipeline until they are ready, whose depth values may
+    /// differ slightly from those of the vertex shader for these frames.
+    /// In a core profile context, render() waits for them.
     void setVertexShader(const std::string& vertexShader);
 
+    /// Sets the modelview and the projection matrix, each given as 16 floats
+    /// in column-major order (as for glLoadMatrixf()). This is only required
+    /// for rendering in a core profile context, where the matrices cannot be
+    /// read from OpenGL. In a compatibility context, OpenCSG uses the
+    /// current OpenGL matrices and ignores the ones set here.
+    void setMatrices(const float modelview[16], const float projection[16]);
+
+    /// Builds the shader programs that render() needs for the current
+    /// vertex shader in the current OpenGL context and OpenCSG context
+    /// (see setContext()), i.e., the merge programs of both algorithms.
+    /// Otherwise, they are built during the first call of render() in a
+    /// context, which then stalls noticeably. Call it with the OpenGL
+    /// context current, after setVertexShader() and setProgramBinaryCache().
+    /// If the driver compiles in parallel (GL_KHR_parallel_shader_compile),
+    /// warmUp() only starts building the programs and returns immediately.
+    void warmUp();
+
+    /// Sets a directory in which OpenCSG keeps the binaries of its GLSL
+    /// programs (requires GL_ARB_get_program_binary), such that they need
+    /// not be compiled again by later runs of the application. A binary
+    /// is only used by the driver (vendor, renderer and version) that has
+    /// created it, and for the same shader sources. The directory must
+    /// exist. With an empty string (the default), nothing is cached.
+    void setProgramBinaryCache(const std::string& directory);
+    /// Returns the directory set with setProgramBinaryCache().
+    std::string getProgramBinaryCache();
+
     /// OpenCSG option for use with setOption() / getOption() below
     enum OptionType {
         AlgorithmSetting          = 0,
@@ -141,16 +372,65 @@ namespace OpenCSG {
         OffscreenSetting          = 2,
         DepthBoundsOptimization   = 3,
         CameraOutsideOptimization = 4,
-        OptionTypeUnused          = 5
+        StatisticsSetting         = 5,
+        GPUTimerSetting           = 6,
+        DebugGroupSetting         = 7,
+        AutoTuneSetting           = 8,
+        ResolutionSetting         = 9,
+        TileSizeSetting           = 10,
+        SharedDepthStencilSetting = 11,
+        OptionTypeUnused          = 12
     };
 
     /// Sets an OpenCSG option.
     /// The option parameter specifies which option to set. The newSetting
     /// is the new setting and should be one of the Algorithm, 
     /// DepthComplexityAlgorithm, or OffscreenType enums below.
+    /// For the StatisticsSetting, it is 1 to collect Statistics during
+    /// render() (see getStatistics() below), or 0 (the default) not to.
+    /// Likewise, a GPUTimerSetting of 1 measures the GPU time of the phases
+    /// of render() with timer queries (requires OpenGL 3.3), see
+    /// getGPUTimes() below. A DebugGroupSetting of 1 wraps the scopes of
+    /// work in render() (see TraceCallback below) into debug groups with
+    /// glPushDebugGroup() / glPopDebugGroup(), which show up in GPU
+    /// debuggers and profilers (requires GL_KHR_debug). An AutoTuneSetting
+    /// of 1 lets the Automatic algorithm learn the fastest settings for
+    /// each CSG product by measuring them (see loadAutoTuning() below).
+    /// The ResolutionSetting is one of the Resolution enums below.
+    /// The TileSizeSetting bounds the width and height of the offscreen
+    /// buffer in pixels. A larger canvas is rendered in tiles of that size,
+    /// skipping tiles outside the bounding boxes of the intersected
+    /// primitives. This caps the memory of the offscreen buffer on large
+    /// displays. With 0 (the default), tiles are only used if the canvas
+    /// exceeds the maximum texture or renderbuffer size. The canvas is
+    /// computed at full resolution if tiled (see Resolution), and
+    /// renderProgressive() never tiles.
+    /// A SharedDepthStencilSetting of 1 lets the SCS algorithm render
+    /// directly into the packed depth / stencil attachment of the frame
+    /// buffer object bound by the application, if it is not multisampled
+    /// and the same renderbuffer or texture is attached as depth and as
+    /// stencil buffer. This avoids allocating the depth and stencil buffer
+    /// of the offscreen buffer and the pass merging its depth values into
+    /// the application's depth buffer. The stencil buffer is overwritten,
+    /// and inside the screen-space bounding box of the intersected
+    /// primitives, so is the depth buffer, which therefore should contain
+    /// nothing but the cleared depth of 1 when calling render(). Hence,
+    /// the results of render() calls that overlap on screen do not
+    /// combine. The setting is ignored for the default framebuffer, by
+    /// the Goldfeather algorithm, and by renderProgressive(). The canvas
+    /// is never tiled with it.
+    /// The options are shared by all threads.
     void setOption(OptionType option, int newSetting);
-    /// Returns the current setting of the provided option type.
+    /// Returns the current setting of the provided option type for the
+    /// calling thread, see setThreadOption().
     int  getOption(OptionType option);
+    /// Overrides an option for the calling thread only, such that threads
+    /// rendering at the same time can use different settings. The
+    /// override takes precedence over the setting of setOption() until
+    /// resetThreadOptions() is called.
+    void setThreadOption(OptionType option, int newSetting);
+    /// Removes the overrides of all options by the calling thread.
+    void resetThreadOptions();
 
     /// The Algorithm specifies the method used for CSG rendering:
     ///   - Goldfeather: This algorithm handles convex and concave primitives.
@@ -159,12 +439,19 @@ namespace OpenCSG {
     ///                  to be more robust.
     ///   - SCS        : This algorithm handles only convex primitives.
     ///                  It is usually faster than Goldfeather.
-    ///   - Automatic  : This setting currently choses Goldfeather if the
-    ///                  primitive vector contains concave primitives, else it
-    ///                  choses SCS. Also sets the DepthComplexityAlgorithm
-    ///                  (NoDepthComplexitySampling for arrays with few
-    ///                  primitives, else OcclusionQuery or at the last resort
-    ///                  DepthComplexitySampling). This setting is the default.
+    ///   - Automatic  : This setting choses the Algorithm and the
+    ///                  DepthComplexityAlgorithm with the lowest estimated
+    ///                  cost (see estimateCosts() below). SCS is only
+    ///                  considered if all primitives are convex. For
+    ///                  products beyond the range of the cost model, it
+    ///                  choses SCS for convex and Goldfeather for concave
+    ///                  primitives, with occlusion queries for more than
+    ///                  20 primitives, or without them, depth complexity
+    ///                  sampling for more than 40 primitives.
+    ///                  With the AutoTuneSetting, the combinations with
+    ///                  the lowest estimated costs are timed on the GPU
+    ///                  instead, and the fastest one is used afterwards.
+    ///                  This setting is the default.
     enum Algorithm {
         Automatic        = 0,
         Goldfeather      = 1,
@@ -263,18 +550,305 @@ namespace OpenCSG {
     ///       in the example application.
     ///     * The more compatible approach is also consistently slower.
 
+    ///     With OptimizationAutomatic, OpenCSG decides in each call of
+    ///     render() whether the camera can be inside of the CSG model: the
+    ///     optimization is enabled only if no primitive may be clipped by
+    ///     the near plane. This is tested with the hull points or the
+    ///     bounding box in object coordinates of a primitive if it has one,
+    ///     else with the z range of its bounding box set with
+    ///     setBoundingBox(). A primitive whose box reaches the near plane,
+    ///     including one without any bounding box, disables the optimization.
+
     /// Each optimization can be independently set
     ///   - OptimizationDefault     to its default value
     ///   - OptimizationForceOn     on (does not check OpenGL extensions)
     ///   - OptimizationOn          on if required OpenGL extensions are supported,
     ///   - OptimizationOff         off
+    ///   - OptimizationAutomatic   on where it is safe (CameraOutsideOptimization
+    ///                             only, else off)
     enum Optimization {
         OptimizationDefault   = 0,
         OptimizationForceOn   = 1,
         OptimizationOn        = 2,
-        OptimizationOff       = 3
+        OptimizationOff       = 3,
+        OptimizationAutomatic = 4
+    };
+
+    /// The Resolution sets the resolution at which the CSG product is
+    /// computed in the offscreen buffer, relative to the viewport. At half
+    /// or quarter resolution, the passes of the CSG algorithms fill only a
+    /// fourth or a sixteenth of the pixels, which makes fill-bound scenes
+    /// much faster. The primitives are merged into the z-buffer at full
+    /// resolution, so the depth values remain exact, but the visibility of
+    /// each primitive is looked up at the reduced resolution. Pixels near
+    /// the edges of the CSG product, where this lookup is not reliable, are
+    /// left out, and the areas containing them are computed again at full
+    /// resolution afterwards. Only details smaller than a pixel at reduced
+    /// resolution may be missed. Finding the areas waits for the GPU once
+    /// per call of render(). This is meant for previews, such as during
+    /// camera motion:
+    ///   - FullResolution: Computes at full resolution. This is the default.
+    ///   - HalfResolution, QuarterResolution: Always compute at half or
+    ///                  quarter resolution.
+    ///   - HalfResolutionWhileMoving, QuarterResolutionWhileMoving: Compute
+    ///                  at half or quarter resolution, unless the same CSG
+    ///                  product has been rendered with the same modelview and
+    ///                  projection matrix and viewport in one of the last
+    ///                  calls of render(). So rendering is fast while the
+    ///                  camera moves, and exact once it stops, also if
+    ///                  several CSG products are rendered per frame.
+    /// The reduced resolution requires frame buffer objects, GLSL, and that
+    /// the offscreen buffer is not a rectangular texture (i.e., OpenGL 3.0
+    /// or ARB_texture_non_power_of_two). renderProgressive() and tiled
+    /// canvases (see TileSizeSetting) are always computed at full resolution.
+    enum Resolution {
+        FullResolution               = 0,
+        HalfResolution               = 1,
+        QuarterResolution            = 2,
+        HalfResolutionWhileMoving    = 3,
+        QuarterResolutionWhileMoving = 4,
+        ResolutionUnused             = 5
+    };
+
+    /// The StatisticsPhase denotes the phases of the CSG algorithms in
+    /// which primitives are rendered:
+    ///   - DepthComplexityPhase: Sampling the depth complexity
+    ///                  (DepthComplexitySampling only).
+    ///   - IntersectionPhase: SCS, rendering the intersected primitives.
+    ///   - SubtractionPhase: SCS, subtracting the subtracted primitives.
+    ///   - LayerPhase:  Goldfeather, rendering a depth layer of the
+    ///                  primitives, i.e., the shapes of interest.
+    ///   - ParityPhase: Goldfeather, the parity test of the shapes of
+    ///                  interest against all primitives.
+    ///   - DiscardPhase: Goldfeather, discarding the fragments of the shapes
+    ///                  of interest that have failed the parity test.
+    ///   - MergePhase:  Both algorithms, transferring the visible
+    ///                  surfaces from the offscreen buffer channels into
+    ///                  the depth buffer.
+    enum StatisticsPhase {
+        DepthComplexityPhase  = 0,
+        IntersectionPhase     = 1,
+        SubtractionPhase      = 2,
+        LayerPhase            = 3,
+        ParityPhase           = 4,
+        MergePhase            = 5,
+        DiscardPhase          = 6,
+        StatisticsPhaseUnused = 7
+    };
+
+    /// Statistics of the calls of render(), for tuning scenes and choosing
+    /// options. They are summed up over all calls of render() since the
+    /// last call of resetStatistics(), so resetting them before render()
+    /// gives the statistics of a single call, and resetting them once per
+    /// frame those of a frame. They are only collected while the
+    /// StatisticsSetting option is 1. If OpenCSG has been compiled with
+    /// OPENCSG_NO_STATISTICS defined (CMake option OPENCSG_STATISTICS=OFF),
+    /// they are never collected.
+    struct Statistics {
+        Statistics();
+
+        /// the algorithm that has rendered the primitives in the last call
+        /// of render(). Differs from the AlgorithmSetting if that is Automatic
+        Algorithm algorithm;
+        /// the depth complexity algorithm used in the last call of render().
+        /// Differs from the DepthComplexitySetting if the algorithm is
+        /// chosen automatically, or if occlusion queries are not supported
+        DepthComplexityAlgorithm depthComplexityAlgorithm;
+        /// the CameraOutsideOptimization used in the last call of render().
+        /// Differs from the setting if that is OptimizationAutomatic, or
+        /// with the AutoTuneSetting
+        Optimization cameraOutsideOptimization;
+        /// number of primitives, with each instance of an
+        /// InstancedPrimitive counted separately
+        unsigned int primitives;
+        /// number of primitives whose bounding box is outside the viewport
+        unsigned int culledPrimitives;
+        /// number of batches of primitives that do not overlap on screen.
+        /// 0 if the algorithm does not batch the primitives
+        unsigned int batches;
+        /// SCS: number of subtraction steps actually run
+        unsigned int sequenceIterations;
+        /// Goldfeather: number of depth layers rendered
+        unsigned int layers;
+        /// number of rendered primitives in each phase, either by
+        /// Primitive::render() or within combined draw calls
+        unsigned int renderCalls[StatisticsPhaseUnused];
+        /// number of clears of the stencil buffer
+        unsigned int stencilClears;
+        /// number of clears of the depth buffer
+        unsigned int depthClears;
+        /// number of merges of offscreen buffer channels into the depth buffer
+        unsigned int channelMerges;
+        /// number of occlusion query results read back
+        unsigned int occlusionQueries;
+        /// sum of the samples counted by the occlusion queries
+        unsigned int occlusionQuerySamples;
+        /// maximum depth complexity measured (DepthComplexitySampling only)
+        unsigned int depthComplexity;
+        /// number of tiles rendered, 0 if the canvas has not been tiled
+        /// (see TileSizeSetting). Includes the areas refined at full
+        /// resolution (see Resolution)
+        unsigned int tiles;
+        /// number of tiles skipped, since they are outside the bounding
+        /// box of an intersected primitive
+        unsigned int skippedTiles;
+        /// GPU time in milliseconds spent in each phase (GPUTimerSetting
+        /// only). The GPU time of a call of render() is read back without
+        /// waiting, at one of the following calls of render(), so it is
+        /// added here later than the other statistics of that call.
+        double gpuTime[StatisticsPhaseUnused];
+        /// number of calls of render() whose GPU time is in gpuTime
+        unsigned int gpuTimedRenders;
+        /// estimated time in milliseconds of the algorithms used (see
+        /// estimateCosts() below). Only estimated if the AlgorithmSetting
+        /// is Automatic, so it stays 0 for an explicitly set algorithm
+        double estimatedTime;
     };
 
+    /// Returns the statistics collected since the last resetStatistics().
+    const Statistics& getStatistics();
+    /// Resets all statistics to zero.
+    void resetStatistics();
+    /// Returns the GPU time in milliseconds spent in each phase by the
+    /// most recent call of render() in the current context whose timer
+    /// queries have been read back, while the GPUTimerSetting was 1.
+    /// Returns false if there is no such call (yet).
+    bool getGPUTimes(double milliseconds[StatisticsPhaseUnused]);
+
+    /// The estimated cost of rendering an array of primitives with each
+    /// combination of Algorithm and DepthComplexityAlgorithm, as used by
+    /// the Automatic setting for choosing the cheapest one. The estimate
+    /// is derived from the bounding boxes of the primitives in screen
+    /// space (see Primitive::setBoundingBox()), so it can only be as good
+    /// as these. All areas are clipped to the intersected area, since the
+    /// CSG algorithms do not touch pixels outside of it.
+    struct CostEstimate {
+        CostEstimate();
+
+        /// number of primitives that are not culled
+        unsigned int primitives;
+        /// number of intersected and subtracted primitives thereof
+        unsigned int intersected;
+        unsigned int subtracted;
+        /// maximum convexity of the primitives
+        unsigned int convexity;
+        /// number of batches of all primitives (Goldfeather), and of the
+        /// subtracted primitives (SCS). 0 if the costs are not estimated
+        unsigned int batches;
+        unsigned int subtractedBatches;
+        /// maximum depth complexity of all primitives, and of the
+        /// subtracted primitives only, estimated by sampling how many
+        /// bounding boxes overlap, with the convexity of each
+        unsigned int depthComplexity;
+        unsigned int subtractedDepthComplexity;
+        /// area in pixels that is covered by all intersected primitives
+        double intersectedArea;
+        /// sum of the areas of the bounding boxes in pixels
+        double primitiveArea;
+        /// estimated time in milliseconds, indexed by Algorithm and
+        /// DepthComplexityAlgorithm. Negative for the Automatic algorithm
+        /// and for combinations that cannot be used, i.e., SCS for concave
+        /// primitives, and OcclusionQuery without hardware support. All
+        /// costs are negative for more than 64 primitives or a depth
+        /// complexity above 16, beyond the scenes the costs are fitted to.
+        double milliseconds[3][3];
+    };
+
+    /// Estimates the costs of rendering the primitives with render(),
+    /// using the current OpenGL matrices and viewport. This is what the
+    /// Automatic setting does internally, and is provided for debugging.
+    void estimateCosts(const std::vector<Primitive*>& primitives, CostEstimate& estimate);
+
+    /// With the AutoTuneSetting set to 1 and the Automatic algorithm,
+    /// render() identifies each CSG product by a signature made of the
+    /// counts, the depth complexity and the quantized intersected area of
+    /// its CostEstimate. During the first calls of render() for a product,
+    /// the combinations of Algorithm, DepthComplexityAlgorithm and
+    /// CameraOutsideOptimization with an estimated cost close to the lowest
+    /// one are used in turn and timed with timestamp queries. Then, the
+    /// fastest combination is used, until the product has been rendered
+    /// 1000 times and the combinations are timed again. The
+    /// CameraOutsideOptimization is only ever disabled for this, since
+    /// enabling it is incorrect if the camera is inside of the product.
+    /// Timing requires OpenGL 3.3. Else, the AutoTuneSetting is ignored.
+    /// Products are learned per context.
+
+    /// Writes the fastest combination of each product learned so far in
+    /// the current context to a small text file, for use in later sessions.
+    /// Returns false if the file cannot be written.
+    bool saveAutoTuning(const std::string& filename);
+    /// Reads the products from a file written by saveAutoTuning(). Their
+    /// combinations are used right away, until they are timed again.
+    /// The file is ignored if it has been written for a different
+    /// GL_RENDERER. Returns false if it cannot be read or is ignored.
+    bool loadAutoTuning(const std::string& filename);
+
+    /// Interface for receiving the scopes of work done by render(), e.g.,
+    /// for lining them up with the frame timeline of the application.
+    /// Scopes are properly nested. The name of a scope is a string literal,
+    /// such as "SCS.subtract.iteration" for a single step of subtracting a
+    /// batch of primitives in the SCS algorithm, so the pointer stays valid.
+    /// The index is, depending on the scope, the index of the batch or of
+    /// the depth layer that is processed, or -1. If OpenCSG has been
+    /// compiled with OPENCSG_NO_TRACE defined (CMake option
+    /// OPENCSG_TRACE=OFF), no scopes are reported at all.
+    class TraceCallback {
+    public:
+        virtual ~TraceCallback();
+        /// called when the scope begins
+        virtual void beginScope(const char* name, int index) = 0;
+        /// called when the scope ends
+        virtual void endScope(const char* name, int index) = 0;
+    };
+
+    /// Sets the callback that receives the scopes of render(), or 0 (the
+    /// default) to report no scopes. The callback is not owned by OpenCSG.
+    void setTraceCallback(TraceCallback* callback);
+    /// Returns the current trace callback.
+    TraceCallback* getTraceCallback();
+
+    /// A TraceCallback that records the scopes with time stamps of a
+    /// monotonic clock and writes them in the Chrome trace event format.
+    /// The files can be viewed in chrome://tracing or in Perfetto.
+    class ChromeTraceRecorder : public TraceCallback {
+    public:
+        ChromeTraceRecorder();
+        virtual ~ChromeTraceRecorder();
+        virtual void beginScope(const char* name, int index);
+        virtual void endScope(const char* name, int index);
+
+        /// Discards all scopes recorded so far.
+        void clear();
+        /// Writes the recorded scopes to a JSON file. Returns false
+        /// if the file could not be written.
+        bool write(const std::string& filename) const;
+
+    private:
+        struct Event {
+            const char* name;
+            int index;
+            bool begin;
+            double microseconds;
+        };
+        std::vector<Event> mEvents;
+    };
+
+    /// Requests that the next call of render() is captured to a file, for
+    /// reproducing performance problems outside of the application. The
+    /// capture holds the options, the vertex shader, the matrices, the
+    /// viewport and the scissor box, and for each primitive its operation,
+    /// convexity and bounding box, together with the triangles that it
+    /// renders, recorded with transform feedback in clip coordinates. The
+    /// tool opencsgreplay renders captures headlessly with timing, with
+    /// the same or other options. Capturing requires OpenGL 3.0 and takes
+    /// a while, so the captured call of render() is not representative
+    /// for the timing itself. Transform feedback records triangles only:
+    /// if a primitive renders points or lines, or GL_QUADS or GL_POLYGON
+    /// on drivers that do not split them into triangles, the capture
+    /// fails. If the capture fails or the file cannot be written, nothing
+    /// is captured. An empty filename cancels the request.
+    void captureNextRender(const std::string& filename);
+
     /// Setting the context is required for applications rendering with
     /// OpenCSG in different OpenGL windows with OpenGL contexts that
     /// are not shared. This is needed for internal OpenGL resources,
@@ -289,6 +863,14 @@ namespace OpenCSG {
     /// The value of context has no specific meaning for OpenCSG;
     /// it is only used as key in a dictionary to access the OpenGL
     /// resources. The default context is 0.
+    /// The context is selected per thread. Threads can render with
+    /// OpenCSG at the same time, each with its own OpenGL context and
+    /// context identifier. Like the context, the vertex shader, the
+    /// matrices, the trace callback, the statistics and a requested
+    /// capture are kept per thread, so each thread must set them up for
+    /// itself. The options are shared, but can be overridden per thread
+    /// with setThreadOption(). Two threads must not use the same
+    /// identifier at the same time.
     void setContext(int context);
     /// Returns the current context.
     int getContext();
@@ -296,6 +878,48 @@ namespace OpenCSG {
     /// context. 
     void freeResources();
 
+    /// Sets a budget in bytes for the memory of the offscreen buffers of
+    /// all contexts together (0, the default, means no budget). The
+    /// buffers of a context are kept between the calls of render(). If
+    /// the budget is exceeded, the buffers of the least recently used
+    /// other contexts are evicted. Since OpenGL objects can only be
+    /// released in their own context, an evicted context releases its
+    /// buffers at the end of its next render(), or when
+    /// freeEvictedResources() is called for it, which applications should
+    /// do for idle contexts while they are current. The buffers that
+    /// renderProgressive() keeps for each CSG product count as well, and
+    /// their progress is lost on eviction. A budget also bounds the size
+    /// of a single offscreen buffer, such that larger canvases are
+    /// rendered in tiles (see TileSizeSetting).
+    void setOffscreenMemoryBudget(std::size_t bytes);
+    /// Returns the budget for the memory of the offscreen buffers.
+    std::size_t getOffscreenMemoryBudget();
+
+    /// Memory of the offscreen buffers, see getOffscreenMemoryUsage().
+    struct OffscreenMemoryUsage {
+        OffscreenMemoryUsage();
+        /// the budget set with setOffscreenMemoryBudget()
+        std::size_t budget;
+        /// bytes of the offscreen buffers of all contexts
+        std::size_t total;
+        /// bytes of the offscreen buffers of the current context
+        std::size_t current;
+        /// bytes of the offscreen buffers that have been evicted, but
+        /// not been released yet. Included in total
+        std::size_t evicted;
+        /// number of contexts with offscreen buffers
+        unsigned int contexts;
+        /// number of evictions since the program has started
+        unsigned int evictions;
+    };
+
+    /// Returns the current memory of the offscreen buffers.
+    OffscreenMemoryUsage getOffscreenMemoryUsage();
+
+    /// Releases the offscreen buffers of the current context if they have
+    /// been evicted for the memory budget. The context must be current.
+    void freeEvictedResources();
+
 } // namespace OpenCSG
 
 #endif // __OpenCSG__opencsg_h__
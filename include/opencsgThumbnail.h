@@ -0,0 +1,136 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// opencsgThumbnail.h
+//
+// include file for the thumbnail service, an optional component of
+// OpenCSG (library opencsgthumbnail, CMake option BUILD_THUMBNAIL_SERVICE)
+//
+
+#ifndef __OpenCSG__opencsg_thumbnail_h__
+#define __OpenCSG__opencsg_thumbnail_h__
+
+#include <opencsg.h>
+#include <future>
+#include <vector>
+
+namespace OpenCSG {
+
+    /// A primitive of a thumbnail, given as triangle mesh.
+    struct ThumbnailShape {
+        ThumbnailShape();
+
+        Operation operation;
+        unsigned int convexity;
+        /// x, y, z of each vertex
+        std::vector<float> vertices;
+        /// three vertex indices per triangle
+        std::vector<unsigned int> indices;
+        /// RGBA color of the visible surface of the shape
+        float color[4];
+    };
+
+    /// A CSG product, as passed to render().
+    typedef std::vector<ThumbnailShape> ThumbnailProduct;
+
+    /// A thumbnail to be rendered by the ThumbnailService.
+    struct ThumbnailJob {
+        ThumbnailJob();
+
+        /// the CSG products, which are rendered one after another
+        /// into the same depth buffer
+        std::vector<ThumbnailProduct> products;
+        /// the camera, in column-major order as for setMatrices().
+        /// Identity by default
+        float modelview[16];
+        float projection[16];
+        /// size of the image in pixels, 128 x 128 by default
+        int width;
+        int height;
+        /// the options of OpenCSG (see setOption()), all 0 by default
+        int options[OptionTypeUnused];
+        /// RGBA color of the background, transparent black by default
+        float background[4];
+        /// whether the color image is read back. The depth image is
+        /// always read back
+        bool color;
+    };
+
+    /// A rendered thumbnail. The pixels are stored row by row,
+    /// beginning with the bottom row, as read by glReadPixels().
+    struct ThumbnailImage {
+        ThumbnailImage();
+
+        /// 0 if the thumbnail could not be rendered
+        int width;
+        int height;
+        /// depth value of each pixel in [0, 1], 1 for the background
+        std::vector<float> depth;
+        /// RGBA of each pixel, empty if ThumbnailJob::color is false.
+        /// The surfaces are lit by a light at the camera
+        std::vector<unsigned char> color;
+    };
+
+    /// Renders thumbnails of CSG shapes in worker threads, each with its
+    /// own headless OpenGL 3.3 core profile context created with EGL
+    /// (e.g., Mesa llvmpipe on a server without GPU). Jobs are queued and
+    /// taken by the next idle worker. Each worker selects its own OpenCSG
+    /// context (see setContext()), -1 for the first worker, -2 for the
+    /// second and so on, so that the offscreen buffers and programs of
+    /// OpenCSG are reused by all jobs of a worker. So are the framebuffer
+    /// and the vertex buffers of the worker, which only grow if a job
+    /// needs more space. Applications should not use these context
+    /// identifiers themselves.
+    class ThumbnailService {
+    public:
+        /// Starts the workers. With 0, one worker per hardware thread is
+        /// started.
+        explicit ThumbnailService(unsigned int workers = 0);
+        /// Renders all jobs that have been submitted and stops the workers.
+        ~ThumbnailService();
+
+        /// Returns the number of workers that have an OpenGL context.
+        /// If it is 0, no thumbnails can be rendered.
+        unsigned int getWorkers() const;
+
+        /// Queues a job. The job is copied, so it need not be kept.
+        std::future<ThumbnailImage> submit(const ThumbnailJob& job);
+
+        /// Renders a large image, such as for printing, in tiles of at most
+        /// tileSize x tileSize pixels, which the workers render in parallel,
+        /// and assembles their depth and color images. For each tile, the
+        /// projection is narrowed to the tile, so OpenCSG culls the shapes
+        /// outside of it, and the framebuffers of the workers stay small,
+        /// also for images larger than the maximum renderbuffer size. The
+        /// depth values equal the ones of a single image up to rounding.
+        /// Blocks until all tiles are done. If a tile fails, the returned
+        /// image is empty.
+        ThumbnailImage renderTiled(const ThumbnailJob& job, int tileSize = 512);
+
+    private:
+        ThumbnailService(const ThumbnailService&);
+        ThumbnailService& operator=(const ThumbnailService&);
+
+        struct Impl;
+        Impl* mImpl;
+    };
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__opencsg_thumbnail_h__
@@ -0,0 +1,363 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// autoTuner.cpp
+//
+
+#include "opencsgConfig.h"
+#include "autoTuner.h"
+#include "context.h"
+#include "costModel.h"
+#include "settings.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace OpenCSG {
+
+    bool saveAutoTuning(const std::string& filename) {
+        OpenGL::ensureFunctionPointers();
+        return OpenGL::getAutoTuner()->save(filename);
+    }
+
+    bool loadAutoTuning(const std::string& filename) {
+        OpenGL::ensureFunctionPointers();
+        return OpenGL::getAutoTuner()->load(filename);
+    }
+
+    namespace OpenGL {
+
+        namespace {
+
+            // candidates with a higher estimated cost than this factor
+            // times the cheapest one are not probed
+            const double pruneFactor = 2.0;
+
+            const char* fileHeader = "OpenCSG auto-tuning 1";
+
+            std::string renderer() {
+                const GLubyte* s = glGetString(GL_RENDERER);
+                return s ? std::string(reinterpret_cast<const char*>(s)) : std::string();
+            }
+
+            // the number of times value can be divided by base until it
+            // is below 1, i.e., 0 for 0, else 1 + floor(log(value) / log(base))
+            unsigned int bucket(double value, double base) {
+                unsigned int result = 0;
+                for (; value >= 1.0; value /= base) {
+                    ++result;
+                }
+                return result;
+            }
+
+            bool cameraOutsideEnabled(Algorithm algorithm, int setting) {
+                return setting == OptimizationOn
+                    || setting == OptimizationForceOn
+                    || (setting == OptimizationDefault && algorithm == SCS);
+            }
+
+        } // unnamed namespace
+
+        AutoTuner::Candidate::Candidate() :
+            algorithm(Goldfeather),
+            depthComplexityAlgorithm(NoDepthComplexitySampling),
+            cameraOutside(OptimizationDefault)
+        {
+        }
+
+        AutoTuner::Candidate::Candidate(Algorithm a, DepthComplexityAlgorithm d, int c) :
+            algorithm(a),
+            depthComplexityAlgorithm(d),
+            cameraOutside(c)
+        {
+        }
+
+        bool AutoTuner::Candidate::operator==(const Candidate& other) const {
+            return algorithm == other.algorithm
+                && depthComplexityAlgorithm == other.depthComplexityAlgorithm
+                && cameraOutside == other.cameraOutside;
+        }
+
+        AutoTuner::Signature::Signature() {
+            for (int i = 0; i < SignatureSize; ++i) {
+                values[i] = 0;
+            }
+        }
+
+        AutoTuner::Signature::Signature(const CostEstimate& estimate, int cameraOutside) {
+            // the values that depend on the view are quantized, such that
+            // the signature of a product persists when the camera moves
+            values[0] = estimate.primitives;
+            values[1] = estimate.intersected;
+            values[2] = estimate.convexity;
+            values[3] = bucket(estimate.batches, 2.0);
+            values[4] = bucket(estimate.subtractedBatches, 2.0);
+            values[5] = bucket(estimate.depthComplexity, 2.0);
+            values[6] = bucket(estimate.intersectedArea, 4.0);
+            values[7] = static_cast<unsigned int>(cameraOutside);
+        }
+
+        bool AutoTuner::Signature::operator<(const Signature& other) const {
+            for (int i = 0; i < SignatureSize; ++i) {
+                if (values[i] != other.values[i])
+                    return values[i] < other.values[i];
+            }
+            return false;
+        }
+
+        AutoTuner::Timing::Timing(const Candidate& c, double e) :
+            candidate(c),
+            estimate(e),
+            milliseconds(0.0),
+            samples(0),
+            probes(0)
+        {
+        }
+
+        AutoTuner::AutoTuner() :
+            mNext(0),
+            mCurrent(0),
+            mProbe(0)
+        {
+        }
+
+        AutoTuner::~AutoTuner() {
+            for (std::size_t i = 0; i < RingSize; ++i) {
+                if (mRing[i].queries[0])
+                    glDeleteQueries(2, mRing[i].queries);
+            }
+        }
+
+        AutoTuner::Candidate AutoTuner::choose(const CostEstimate& estimate) {
+            collect();
+            mProbe = 0;
+
+            const int cameraOutside = getOption(CameraOutsideOptimization);
+
+            // without estimated costs, there are no candidates to probe, and
+            // probing all combinations may take seconds per frame
+            if (!Algo::inFittedRange(estimate)) {
+                Algorithm algorithm;
+                DepthComplexityAlgorithm depthComplexityAlgorithm;
+                Algo::chooseByConvexity(estimate, algorithm, depthComplexityAlgorithm);
+                return Candidate(algorithm, depthComplexityAlgorithm, cameraOutside);
+            }
+            const Signature signature(estimate, cameraOutside);
+            if (mProducts.size() >= MaxProducts && mProducts.find(signature) == mProducts.end())
+                mProducts.clear();
+            Product& product = mProducts[signature];
+
+            if (product.timings.empty() || product.renders >= ReprobeInterval) {
+                product.timings.clear();
+                product.renders = 0;
+
+                // the candidates are the combinations that the cost model
+                // considers, each with the CameraOutsideOptimization as set.
+                // If it is enabled, it is also tried to disable it, which is
+                // always correct. Enabling it is not, if the camera is inside.
+                const double cheapest = estimate.milliseconds[Goldfeather][NoDepthComplexitySampling];
+                double limit = cheapest;
+                for (int a = Goldfeather; a < Algo::algorithmCount; ++a) {
+                    for (int d = 0; d < Algo::depthComplexityAlgorithmCount; ++d) {
+                        const double cost = estimate.milliseconds[a][d];
+                        if (cost >= 0.0 && cost < limit)
+                            limit = cost;
+                    }
+                }
+                limit *= pruneFactor;
+
+                for (int a = Goldfeather; a < Algo::algorithmCount; ++a) {
+                    for (int d = 0; d < Algo::depthComplexityAlgorithmCount; ++d) {
+                        const double cost = estimate.milliseconds[a][d];
+                        if (cost < 0.0 || cost > limit)
+                            continue;
+                        const Algorithm algorithm = static_cast<Algorithm>(a);
+                        const DepthComplexityAlgorithm depthComplexityAlgorithm = static_cast<DepthComplexityAlgorithm>(d);
+                        product.timings.push_back(Timing(Candidate(algorithm, depthComplexityAlgorithm, cameraOutside), cost));
+                        if (cameraOutsideEnabled(algorithm, cameraOutside))
+                            product.timings.push_back(Timing(Candidate(algorithm, depthComplexityAlgorithm, OptimizationOff), cost));
+                    }
+                }
+
+                // probe the candidates in the order of their estimated costs
+                for (std::size_t i = 1; i < product.timings.size(); ++i) {
+                    for (std::size_t j = i; j > 0 && product.timings[j].estimate < product.timings[j - 1].estimate; --j) {
+                        std::swap(product.timings[j], product.timings[j - 1]);
+                    }
+                }
+            }
+
+            ++product.renders;
+
+            if (product.timings.size() > 1) {
+                for (std::vector<Timing>::iterator itr = product.timings.begin(); itr != product.timings.end(); ++itr) {
+                    if (itr->probes < SamplesPerCandidate) {
+                        mSignature = signature;
+                        mProbe = &*itr;
+                        return itr->candidate;
+                    }
+                }
+            }
+
+            return fastest(product).candidate;
+        }
+
+        void AutoTuner::begin() {
+            mCurrent = 0;
+            if (!mProbe)
+                return;
+
+            Measurement& measurement = mRing[mNext];
+            if (measurement.pending)
+                return;
+
+            if (!measurement.queries[0])
+                glGenQueries(2, measurement.queries);
+
+            ++mProbe->probes;
+            measurement.signature = mSignature;
+            measurement.candidate = mProbe->candidate;
+            mCurrent = &measurement;
+            mNext = (mNext + 1) % RingSize;
+
+            glQueryCounter(mCurrent->queries[0], GL_TIMESTAMP);
+        }
+
+        void AutoTuner::end() {
+            if (!mCurrent)
+                return;
+
+            glQueryCounter(mCurrent->queries[1], GL_TIMESTAMP);
+            mCurrent->pending = true;
+            mCurrent = 0;
+            mProbe = 0;
+        }
+
+        void AutoTuner::collect() {
+            // measurements complete in the order they have been issued,
+            // so stop at the first one that is not available yet
+            for (std::size_t i = 0; i < RingSize; ++i) {
+                Measurement& measurement = mRing[(mNext + i) % RingSize];
+                if (!measurement.pending)
+                    continue;
+                GLuint available = 0;
+                glGetQueryObjectuiv(measurement.queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available)
+                    break;
+
+                GLuint64 begin = 0;
+                GLuint64 end = 0;
+                glGetQueryObjectui64v(measurement.queries[0], GL_QUERY_RESULT, &begin);
+                glGetQueryObjectui64v(measurement.queries[1], GL_QUERY_RESULT, &end);
+                measurement.pending = false;
+
+                // the candidates of the product may have been replaced
+                // for probing them again in the meantime
+                std::map<Signature, Product>::iterator product = mProducts.find(measurement.signature);
+                if (product == mProducts.end())
+                    continue;
+                std::vector<Timing>& timings = product->second.timings;
+                for (std::vector<Timing>::iterator itr = timings.begin(); itr != timings.end(); ++itr) {
+                    if (itr->candidate == measurement.candidate) {
+                        const double milliseconds = static_cast<double>(end - begin) / 1.0e6;
+                        if (itr->samples == 0 || milliseconds < itr->milliseconds)
+                            itr->milliseconds = milliseconds;
+                        ++itr->samples;
+                        break;
+                    }
+                }
+            }
+        }
+
+        const AutoTuner::Timing& AutoTuner::fastest(const Product& product) {
+            const Timing* result = &product.timings.front();
+            for (std::vector<Timing>::const_iterator itr = product.timings.begin(); itr != product.timings.end(); ++itr) {
+                if (itr->samples > 0 && (result->samples == 0 || itr->milliseconds < result->milliseconds))
+                    result = &*itr;
+            }
+            return *result;
+        }
+
+        bool AutoTuner::save(const std::string& filename) const {
+            std::FILE* file = std::fopen(filename.c_str(), "w");
+            if (!file)
+                return false;
+
+            std::fprintf(file, "%s\n%s\n", fileHeader, renderer().c_str());
+            for (std::map<Signature, Product>::const_iterator itr = mProducts.begin(); itr != mProducts.end(); ++itr) {
+                if (itr->second.timings.empty())
+                    continue;
+                const Timing& timing = fastest(itr->second);
+                if (timing.samples == 0)
+                    continue;
+                for (int i = 0; i < SignatureSize; ++i) {
+                    std::fprintf(file, "%u ", itr->first.values[i]);
+                }
+                std::fprintf(file, "%d %d %d %.4f\n",
+                             timing.candidate.algorithm, timing.candidate.depthComplexityAlgorithm,
+                             timing.candidate.cameraOutside, timing.milliseconds);
+            }
+
+            return std::fclose(file) == 0;
+        }
+
+        bool AutoTuner::load(const std::string& filename) {
+            std::FILE* file = std::fopen(filename.c_str(), "r");
+            if (!file)
+                return false;
+
+            // the timings are only meaningful for the same renderer
+            char line[1024];
+            bool valid = std::fgets(line, sizeof(line), file) && std::strncmp(line, fileHeader, std::strlen(fileHeader)) == 0
+                      && std::fgets(line, sizeof(line), file) && std::string(line, std::strcspn(line, "\n")) == renderer();
+
+            while (valid && std::fgets(line, sizeof(line), file)) {
+                Signature signature;
+                unsigned int* v = signature.values;
+                int algorithm, depthComplexityAlgorithm, cameraOutside;
+                double milliseconds;
+                if (std::sscanf(line, "%u %u %u %u %u %u %u %u %d %d %d %lf",
+                                &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7],
+                                &algorithm, &depthComplexityAlgorithm, &cameraOutside, &milliseconds) != 12
+                    || algorithm <= Automatic || algorithm >= Algo::algorithmCount
+                    || depthComplexityAlgorithm < 0 || depthComplexityAlgorithm >= Algo::depthComplexityAlgorithmCount) {
+                    valid = false;
+                    break;
+                }
+
+                // a single candidate is used without probing
+                Timing timing(Candidate(static_cast<Algorithm>(algorithm),
+                                        static_cast<DepthComplexityAlgorithm>(depthComplexityAlgorithm),
+                                        cameraOutside), milliseconds);
+                timing.milliseconds = milliseconds;
+                timing.samples = SamplesPerCandidate;
+                timing.probes = SamplesPerCandidate;
+
+                Product& product = mProducts[signature];
+                product.timings.assign(1, timing);
+                product.renders = 0;
+            }
+
+            std::fclose(file);
+            return valid;
+        }
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
@@ -0,0 +1,150 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// autoTuner.h
+//
+// learns the fastest settings for rendering a CSG product by timing the
+// candidates with timestamp queries over several frames
+//
+
+#ifndef __OpenCSG__auto_tuner_h__
+#define __OpenCSG__auto_tuner_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglExt.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        /// Chooses the Algorithm, DepthComplexityAlgorithm and
+        /// CameraOutsideOptimization for the AutoTuneSetting. CSG products
+        /// are identified by a signature of their cost estimate. For a new
+        /// product, the candidates with an estimated cost close to the
+        /// cheapest one are rendered in turn, each SamplesPerCandidate
+        /// times, and their GPU time is measured. Afterwards, the fastest
+        /// candidate is used, until the product has been rendered
+        /// ReprobeInterval times and the candidates are timed again. If
+        /// more than MaxProducts have been seen, all are forgotten.
+        /// As with the GPUTimer, the queries are read back only once they
+        /// are available, so the CPU never waits for the GPU.
+        class AutoTuner {
+        public:
+            enum {
+                RingSize = 8,
+                SamplesPerCandidate = 2,
+                ReprobeInterval = 1000,
+                MaxProducts = 4096
+            };
+
+            struct Candidate {
+                Candidate();
+                Candidate(Algorithm a, DepthComplexityAlgorithm d, int c);
+                bool operator==(const Candidate& other) const;
+
+                Algorithm algorithm;
+                DepthComplexityAlgorithm depthComplexityAlgorithm;
+                /// the setting of CameraOutsideOptimization
+                int cameraOutside;
+            };
+
+            AutoTuner();
+            /// deletes the query objects. The context must be current.
+            ~AutoTuner();
+
+            /// reads back the timings that are available, then returns the
+            /// candidate for rendering the product described by estimate
+            Candidate choose(const CostEstimate& estimate);
+            /// starts timing the candidate returned by choose(), if it is
+            /// probed and a ring entry is free
+            void begin();
+            /// ends timing the current call of render()
+            void end();
+
+            /// writes the fastest candidate of each product to a file
+            bool save(const std::string& filename) const;
+            /// reads products from a file written by save() with the same
+            /// OpenGL renderer, and uses their candidates without probing
+            bool load(const std::string& filename);
+
+        private:
+            AutoTuner(const AutoTuner&);
+            AutoTuner& operator=(const AutoTuner&);
+
+            enum { SignatureSize = 8 };
+
+            struct Signature {
+                Signature();
+                Signature(const CostEstimate& estimate, int cameraOutside);
+                bool operator<(const Signature& other) const;
+
+                unsigned int values[SignatureSize];
+            };
+
+            struct Timing {
+                Timing(const Candidate& c, double e);
+
+                Candidate candidate;
+                /// estimated cost, for ordering the candidates
+                double estimate;
+                /// minimum of the measured GPU times
+                double milliseconds;
+                unsigned int samples;
+                unsigned int probes;
+            };
+
+            struct Product {
+                Product() : renders(0) {}
+                std::vector<Timing> timings;
+                unsigned int renders;
+            };
+
+            struct Measurement {
+                Measurement() : pending(false) { queries[0] = queries[1] = 0; }
+                GLuint queries[2];
+                Signature signature;
+                Candidate candidate;
+                bool pending;
+            };
+
+            /// reads back the timings of all measurements that are available
+            void collect();
+            /// the timing with the lowest measured time, or the first one
+            static const Timing& fastest(const Product& product);
+
+            std::map<Signature, Product> mProducts;
+            Measurement mRing[RingSize];
+            /// the oldest measurement, which is used next
+            std::size_t mNext;
+            /// the measurement of the current call of render(), or 0
+            Measurement* mCurrent;
+            /// the signature and timing of the candidate to be probed, or 0
+            Signature mSignature;
+            Timing* mProbe;
+        };
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__auto_tuner_h__
@@ -24,6 +24,8 @@
 #include <opencsg.h>
 #include "batch.h"
 #include "primitiveHelper.h"
+#include "statistics.h"
+#include "trace.h"
 
 namespace OpenCSG {
 
@@ -42,6 +44,8 @@ namespace OpenCSG {
 
     Batcher::Batcher(const std::vector<Primitive*>& primitives) { 
 
+        OPENCSG_TRACE_SCOPE("Batcher", -1);
+
         FullscreenPrimitive fullscreen;
 
         const std::size_t numberOfPrimitives = primitives.size();
@@ -53,8 +57,10 @@ namespace OpenCSG {
         for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
 
             // primitive completely outside viewport, no need to process it any further
-            if (!Algo::intersectXY(*itr, &fullscreen))
+            if (!Algo::intersectXY(*itr, &fullscreen)) {
+                OPENCSG_STATISTICS(++stats->culledPrimitives);
                 continue;
+            }
 
             // fullscreen is completely part of the primitive's bounding box,
             // no other primitive can be part of the same batch
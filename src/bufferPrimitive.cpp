@@ -0,0 +1,64 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// bufferPrimitive.cpp
+//
+// implements BufferPrimitive (declared in opencsg.h)
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglExt.h"
+
+namespace OpenCSG {
+
+    BufferPrimitive::BufferPrimitive(Operation o, unsigned int c,
+                                     unsigned int vertexArray, unsigned int firstIndex,
+                                     unsigned int count, int baseVertex) :
+        Primitive(o, c),
+        mVertexArray(vertexArray),
+        mFirstIndex(firstIndex),
+        mCount(count),
+        mBaseVertex(baseVertex) {
+    }
+
+    unsigned int BufferPrimitive::getVertexArray() const {
+        return mVertexArray;
+    }
+
+    unsigned int BufferPrimitive::getFirstIndex() const {
+        return mFirstIndex;
+    }
+
+    unsigned int BufferPrimitive::getCount() const {
+        return mCount;
+    }
+
+    int BufferPrimitive::getBaseVertex() const {
+        return mBaseVertex;
+    }
+
+    void BufferPrimitive::render() {
+        glBindVertexArray(mVertexArray);
+        glDrawElementsBaseVertex(GL_TRIANGLES, mCount, GL_UNSIGNED_INT,
+                                 reinterpret_cast<const void*>(mFirstIndex * sizeof(GLuint)),
+                                 mBaseVertex);
+    }
+
+} // namespace OpenCSG
@@ -0,0 +1,252 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// capture.cpp
+//
+// The capture is a text file:
+//
+//   OpenCSG capture 1
+//   renderer <GL_RENDERER>
+//   profile core|compatibility
+//   options <OptionTypeUnused> <setting of each OptionType>
+//   viewport <x> <y> <width> <height>
+//   scissor <enabled> <x> <y> <width> <height>
+//   modelview <16 floats, column-major>
+//   projection <16 floats, column-major>
+//   vertexshader <length>
+//   <source of the vertex shader, length characters>
+//   primitives <count>
+//
+// followed by each primitive:
+//
+//   primitive <operation> <convexity> <bounding box, 6 floats> <triangles>
+//   <x> <y> <z> <w>
+//   ...
+//
+// with three vertices in clip coordinates for each triangle, i.e., as
+// written to gl_Position, so that replaying does not need the vertex
+// shader or the matrices. The bounding box is the one used by render(),
+// i.e., projected from the hull points or the object bounding box if the
+// primitive has them.
+//
+
+#include "opencsgConfig.h"
+#include "capture.h"
+#include "context.h"
+#include "openglHelper.h"
+#include "projection.h"
+#include "settings.h"
+#include <cstdio>
+
+namespace OpenCSG {
+
+    namespace {
+
+        thread_local std::string gFilename;
+
+        const char* fileHeader = "OpenCSG capture 1";
+
+        // transforms like the fixed function pipeline
+        const char compatibilityVertexShader[] =
+            "#version 110\n"
+            "void main() {\n"
+            "    gl_Position = ftransform();\n"
+            "}\n";
+
+        // the vertex shader that render() uses, linked without fragment
+        // shader for recording gl_Position with transform feedback
+        GLuint createProgram(const char* vertexShader) {
+            GLuint shader = OpenGL::getGLSLVertexShader(vertexShader);
+            GLuint program = glCreateProgram();
+            glAttachShader(program, shader);
+            const char* varying = "gl_Position";
+            glTransformFeedbackVaryings(program, 1, &varying, GL_INTERLEAVED_ATTRIBS);
+            glLinkProgram(program);
+            glDeleteShader(shader);
+
+            GLint linked = 0;
+            glGetProgramiv(program, GL_LINK_STATUS, &linked);
+            if (!linked) {
+                glDeleteProgram(program);
+                return 0;
+            }
+
+            if (GLAD_GL_VERSION_3_1) {
+                GLuint matrices = glGetUniformBlockIndex(program, "OpenCSGMatrices");
+                if (matrices != GL_INVALID_INDEX)
+                    glUniformBlockBinding(program, matrices, OpenGL::matrixUniformBufferBinding);
+            }
+
+            return program;
+        }
+
+        // records the triangles of the primitive into vertices, four
+        // floats per vertex. The buffer grows until all triangles fit.
+        // Transform feedback in GL_TRIANGLES mode fails with
+        // GL_INVALID_OPERATION for other primitive types, and on some
+        // drivers also for GL_QUADS and GL_POLYGON. Returns false then.
+        bool captureTriangles(Primitive* primitive, GLuint query, std::vector<GLfloat>& vertices) {
+            GLuint capacity = 1024;
+            GLuint written = 0;
+            for (;;) {
+                glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, capacity * 12 * sizeof(GLfloat), 0, GL_STREAM_READ);
+                glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, query);
+                glBeginTransformFeedback(GL_TRIANGLES);
+                primitive->render();
+                const GLenum error = glGetError();
+                glEndTransformFeedback();
+                glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+                if (error == GL_INVALID_OPERATION)
+                    return false;
+                glGetQueryObjectuiv(query, GL_QUERY_RESULT, &written);
+                if (written < capacity)
+                    break;
+                capacity *= 4;
+            }
+
+            vertices.resize(written * 12);
+            if (written > 0)
+                glGetBufferSubData(GL_TRANSFORM_FEEDBACK_BUFFER, 0, vertices.size() * sizeof(GLfloat), &vertices[0]);
+            return true;
+        }
+
+        void writeFloats(std::FILE* file, const char* name, const GLfloat* v, int count) {
+            std::fprintf(file, "%s", name);
+            for (int i = 0; i < count; ++i) {
+                std::fprintf(file, " %.9g", v[i]);
+            }
+            std::fprintf(file, "\n");
+        }
+
+    } // unnamed namespace
+
+    void captureNextRender(const std::string& filename) {
+        gFilename = filename;
+        Capture::pending = !filename.empty();
+    }
+
+    namespace Capture {
+
+        thread_local bool pending = false;
+
+        bool write(const std::vector<Primitive*>& primitives) {
+            pending = false;
+            if (!GLAD_GL_VERSION_3_0)
+                return false;
+
+            const bool core = OpenGL::isCoreProfile();
+            const char* vertexShader = core ? OpenGL::coreVertexShader() : getVertexShader();
+            GLuint program = createProgram(vertexShader ? vertexShader : compatibilityVertexShader);
+            if (!program)
+                return false;
+
+            std::FILE* file = std::fopen(gFilename.c_str(), "w");
+            if (!file) {
+                glDeleteProgram(program);
+                return false;
+            }
+
+            OpenGL::fetchMatrices();
+            Algo::projectBoundingBoxes(primitives);
+
+            const GLubyte* renderer = glGetString(GL_RENDERER);
+            std::fprintf(file, "%s\n", fileHeader);
+            std::fprintf(file, "renderer %s\n", renderer ? reinterpret_cast<const char*>(renderer) : "");
+            std::fprintf(file, "profile %s\n", core ? "core" : "compatibility");
+            std::fprintf(file, "options %d", OptionTypeUnused);
+            for (int i = 0; i < OptionTypeUnused; ++i) {
+                std::fprintf(file, " %d", getOption(static_cast<OptionType>(i)));
+            }
+            std::fprintf(file, "\n");
+            const GLint* v = OpenGL::canvasPos;
+            std::fprintf(file, "viewport %d %d %d %d\n", v[0], v[1], v[2], v[3]);
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            std::fprintf(file, "scissor %d %d %d %d %d\n", glIsEnabled(GL_SCISSOR_TEST) ? 1 : 0,
+                         scissor[0], scissor[1], scissor[2], scissor[3]);
+            writeFloats(file, "modelview", OpenGL::modelview, 16);
+            writeFloats(file, "projection", OpenGL::projection, 16);
+            const std::string source = getVertexShader() ? getVertexShader() : "";
+            std::fprintf(file, "vertexshader %u\n%s\n", static_cast<unsigned int>(source.size()), source.c_str());
+            std::fprintf(file, "primitives %u\n", static_cast<unsigned int>(primitives.size()));
+
+            GLint oldProgram = 0;
+            GLint oldVertexArray = 0;
+            GLint oldFeedbackBuffer = 0;
+            glGetIntegerv(GL_CURRENT_PROGRAM, &oldProgram);
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVertexArray);
+            glGetIntegerv(GL_TRANSFORM_FEEDBACK_BUFFER_BINDING, &oldFeedbackBuffer);
+            const GLboolean rasterizerDiscard = glIsEnabled(GL_RASTERIZER_DISCARD);
+
+            glUseProgram(program);
+            if (core) {
+                OpenGL::uploadMatrices();
+                OpenGL::setInstanceMatrix(0);
+            }
+            glEnable(GL_RASTERIZER_DISCARD);
+
+            // errors of the application must not be taken for those of
+            // captureTriangles()
+            while (glGetError() != GL_NO_ERROR) { }
+
+            GLuint buffer, query;
+            glGenBuffers(1, &buffer);
+            glGenQueries(1, &query);
+            glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffer);
+
+            bool captured = true;
+            std::vector<GLfloat> vertices;
+            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+                if (!captureTriangles(*itr, query, vertices)) {
+                    captured = false;
+                    break;
+                }
+
+                float box[6];
+                (*itr)->getBoundingBox(box[0], box[1], box[2], box[3], box[4], box[5]);
+                std::fprintf(file, "primitive %d %u %.9g %.9g %.9g %.9g %.9g %.9g %u\n",
+                             (*itr)->getOperation(), (*itr)->getConvexity(),
+                             box[0], box[1], box[2], box[3], box[4], box[5],
+                             static_cast<unsigned int>(vertices.size() / 12));
+                for (std::vector<GLfloat>::const_iterator vtx = vertices.begin(); vtx != vertices.end(); vtx += 4) {
+                    std::fprintf(file, "%.9g %.9g %.9g %.9g\n", vtx[0], vtx[1], vtx[2], vtx[3]);
+                }
+            }
+
+            glDeleteQueries(1, &query);
+            glDeleteBuffers(1, &buffer);
+            glDeleteProgram(program);
+
+            if (!rasterizerDiscard)
+                glDisable(GL_RASTERIZER_DISCARD);
+            glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, oldFeedbackBuffer);
+            glBindVertexArray(oldVertexArray);
+            glUseProgram(oldProgram);
+
+            // an incomplete capture is not left behind
+            if (std::fclose(file) != 0 || !captured) {
+                std::remove(gFilename.c_str());
+                return false;
+            }
+            return true;
+        }
+
+    } // namespace Capture
+
+} // namespace OpenCSG
@@ -0,0 +1,55 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// capture.h
+//
+// writes a call of render() to a file, for replaying it with opencsgreplay
+//
+
+#ifndef __OpenCSG__capture_h__
+#define __OpenCSG__capture_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include <string>
+#include <vector>
+
+namespace OpenCSG {
+
+    /// redeclared from opencsg.h
+    void captureNextRender(const std::string& filename);
+
+    namespace Capture {
+
+        /// true if the next call of render() is to be captured
+        extern thread_local bool pending;
+
+        /// writes the settings, the OpenGL state and the geometry of the
+        /// primitives, as transformed by the vertex shader, to the file
+        /// given to captureNextRender(), and clears the request. Returns
+        /// false if the file cannot be written, if OpenGL 3.0 (transform
+        /// feedback) is missing, or if transform feedback fails for the
+        /// primitive types rendered. The OpenGL state is left unchanged.
+        bool write(const std::vector<Primitive*>& primitives);
+
+    } // namespace Capture
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__capture_h__
@@ -26,14 +26,18 @@
 #include "context.h"
 #include "offscreenBuffer.h"
 #include "openglHelper.h"
+#include "refinement.h"
 #include "settings.h"
+#include "stateMemo.h"
+#include "statistics.h"
+#include "trace.h"
 
 #include <algorithm>
 #include <cassert>
 
 namespace OpenCSG {
 
-    bool ChannelManager::gInUse = false;
+    thread_local bool ChannelManager::gInUse = false;
 
     namespace {
 
@@ -55,61 +59,50 @@ namespace OpenCSG {
             glDepthMask(GL_TRUE);
             glStencilMask(0xffffffff);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
             glEnable(GL_DEPTH_TEST);
         }
 
-        template<int FRAMES>
-        class MaximumMemorizer {
-            int mMax;
-            int mSecondMax;
-            int mCounter;
-        public:
-            MaximumMemorizer() : mMax(0), mSecondMax(-1), mCounter(0) { }
-            void newValue(int v) {
-                if (v>=mMax) {
-                    mMax = v;
-                    mSecondMax = -1;
-                    mCounter = 0;
-                } else {
-                    if (v>mSecondMax) {
-                        mSecondMax = v;
-                    }
-                    if (++mCounter >= FRAMES) {
-                        mMax = mSecondMax;
-                        mSecondMax = -1;
-                        mCounter = 0;
-                    }
-                }
-            }
-            int getMax() const {
-                return mMax;
-            }
-        };
+        // the stencil bits of the bound framebuffer
+        GLint queryStencilBits() {
+            GLint stencilBits = 0;
+            if (OpenGL::coreProfile)
+                glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE, &stencilBits);
+            else
+                glGetIntegerv(GL_STENCIL_BITS, &stencilBits);
+            return stencilBits;
+        }
 
     } // unnamed namespace
 
     ChannelManager::ChannelManager()
       : mOffscreenBuffer(0)
+      , mStateMemo(0)
       , mInOffscreenBuffer(false)
+      , mResolutionDivisor(1)
       , mCurrentChannel(NoChannel)
       , mOccupiedChannels(NoChannel)
     {
-        glPushAttrib(GL_ALL_ATTRIB_BITS);
-        glDisable(GL_LIGHTING);
-        glDisable(GL_TEXTURE_1D);
-        glDisable(GL_TEXTURE_2D);
-        if (   OPENCSG_HAS_EXT(ARB_texture_rectangle)
-            || OPENCSG_HAS_EXT(EXT_texture_rectangle)
-            || OPENCSG_HAS_EXT(NV_texture_rectangle))
-            glDisable(GL_TEXTURE_RECTANGLE_ARB);
-        glDisable(GL_TEXTURE_3D); // OpenGL 1.2 - take this as given
-        if (OPENCSG_HAS_EXT(ARB_texture_cube_map))
-            glDisable(GL_TEXTURE_CUBE_MAP_ARB);
-        glDisable(GL_BLEND);
-
-        glGetFloatv(GL_MODELVIEW_MATRIX, OpenGL::modelview);
-        glGetFloatv(GL_PROJECTION_MATRIX, OpenGL::projection);
-        glGetIntegerv(GL_VIEWPORT, OpenGL::canvasPos);
+        OpenGL::coreProfile = OpenGL::isCoreProfile();
+
+        if (OpenGL::coreProfile) {
+            // no attribute stack, no fixed function pipeline, no matrix stack
+            mStateMemo = new OpenGL::StateMemo;
+            glDisable(GL_BLEND);
+        } else {
+            glPushAttrib(GL_ALL_ATTRIB_BITS);
+            glDisable(GL_LIGHTING);
+            glDisable(GL_TEXTURE_1D);
+            glDisable(GL_TEXTURE_2D);
+            if (OpenGL::getCapabilities().textureRectangle)
+                glDisable(GL_TEXTURE_RECTANGLE_ARB);
+            glDisable(GL_TEXTURE_3D); // OpenGL 1.2 - take this as given
+            if (OPENCSG_HAS_EXT(ARB_texture_cube_map))
+                glDisable(GL_TEXTURE_CUBE_MAP_ARB);
+            glDisable(GL_BLEND);
+        }
+
+        OpenGL::fetchMatrices();
 
         if (glIsEnabled(GL_SCISSOR_TEST)) {
             glGetIntegerv(GL_SCISSOR_BOX, OpenGL::scissorPos);
@@ -121,7 +114,7 @@ namespace OpenCSG {
         }
     }
 
-    bool ChannelManager::init() {
+    bool ChannelManager::init(OpenGL::OffscreenBuffer* offscreenBuffer) {
 
         assert(!gInUse);
         if (gInUse)
@@ -133,7 +126,7 @@ namespace OpenCSG {
         if (   newOffscreenType == OpenCSG::AutomaticOffscreenType
             || newOffscreenType == OpenCSG::FrameBufferObject
         ) {
-            if (OPENCSG_HAS_EXT(ARB_framebuffer_object)) {
+            if (OPENCSG_HAS_EXT(ARB_framebuffer_object) || GLAD_GL_VERSION_3_0) {
                 newOffscreenType = OpenCSG::FrameBufferObjectARB;
             }
             else
@@ -148,7 +141,7 @@ namespace OpenCSG {
             }
         }
 
-        mOffscreenBuffer = OpenGL::getOffscreenBuffer(newOffscreenType);
+        mOffscreenBuffer = offscreenBuffer ? offscreenBuffer : OpenGL::getOffscreenBuffer(newOffscreenType);
 
         if (!mOffscreenBuffer)
         {
@@ -162,16 +155,26 @@ namespace OpenCSG {
             return false;
         }
 
-        const int dx = OpenGL::canvasPos[2] - OpenGL::canvasPos[0];
-        const int dy = OpenGL::canvasPos[3] - OpenGL::canvasPos[1];
+        int dx = OpenGL::canvasPos[2] - OpenGL::canvasPos[0];
+        int dy = OpenGL::canvasPos[3] - OpenGL::canvasPos[1];
+        if (OpenGL::tilePos[2] > 0 && !Refinement::refining) {
+            // the offscreen buffer only needs to hold the current tile.
+            // While refining the edges after the reduced resolution, the
+            // buffer keeps the size of the canvas instead of shrinking
+            dx = OpenGL::tilePos[2];
+            dy = OpenGL::tilePos[3];
+        }
 
         int tx = dx;
         int ty = dy;
         // We don't need to enlarge the texture to the next largest power-of-two size if:
         // - the ARB_texture_non_power_of_two extension is supported
         // - or any of the texture rectangle extensions is supported
+        // - or OpenGL 3.0 is supported (which core profile contexts may
+        //   not report as extension)
         // Negating this gives the following expression from hell:
-        if (   !OPENCSG_HAS_EXT(ARB_texture_non_power_of_two)
+        if (   !GLAD_GL_VERSION_3_0
+            && !OPENCSG_HAS_EXT(ARB_texture_non_power_of_two)
             && !OPENCSG_HAS_EXT(ARB_texture_rectangle)
             && !OPENCSG_HAS_EXT(EXT_texture_rectangle)
             && !OPENCSG_HAS_EXT(NV_texture_rectangle)
@@ -181,29 +184,12 @@ namespace OpenCSG {
             ty = nextPow2(dy);
         }
 
-        // The following implements a heuristic that makes the offscreen buffer
-        // smaller if the size of the buffer has been bigger than necessary
-        // in x- or y- direction for resizeOffscreenBufferLimit frames. 
-        //
-        // this permits to use OpenCSG for CSG rendering in different
-        // canvases with different sizes without permanent expensive
-        // resizing of the offscreen buffer for every frame.
-        //
-        // possible improvements: 
-        //   - allow the user to define the resizeOffscreenBufferLimit?
-        static const unsigned int resizeOffscreenBufferLimit = 64;
-
-        static MaximumMemorizer<resizeOffscreenBufferLimit> sizeX;
-        static MaximumMemorizer<resizeOffscreenBufferLimit> sizeY;
-        // tx == ty == 0 happens if the window is minimized, in this case don't touch a thing
-        if (tx != 0 && ty != 0) {
-            sizeX.newValue(tx);
-            sizeY.newValue(ty);
-        }
-
+        // the size of the offscreen buffer follows the recently requested
+        // sizes of the context, see OpenGL::getOffscreenBufferSize()
         bool rebuild = false;
+        GLint stencilBits = 0;
 
-        Dimensions dims(sizeX.getMax(), sizeY.getMax());
+        Dimensions dims = offscreenBuffer ? Dimensions(tx, ty) : OpenGL::getOffscreenBufferSize(tx, ty);
         if (!mOffscreenBuffer->IsInitialized())
         {
             if (!mOffscreenBuffer->Initialize(dims)) {
@@ -232,24 +218,66 @@ namespace OpenCSG {
             // assert(gOffscreenBuffer->HasStencil());
             mOffscreenBuffer->BeginCapture();
             defaults();
-            glGetIntegerv(GL_STENCIL_BITS, &OpenGL::stencilBits);
-            OpenGL::stencilMax = 1 << OpenGL::stencilBits;
-            OpenGL::stencilMask = OpenGL::stencilMax - 1;
+            stencilBits = queryStencilBits();
             mOffscreenBuffer->EndCapture();
             mOffscreenBuffer->Bind();
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         }
+        else if (offscreenBuffer) {
+            mOffscreenBuffer->BeginCapture();
+            stencilBits = queryStencilBits();
+            mOffscreenBuffer->EndCapture();
+        }
+
+        // The stencil bits of the offscreen buffer owned by the context are
+        // kept in its capabilities, since the offscreen buffer of another
+        // context may have been built last. Other buffers, such as the one
+        // of renderProgressive(), are queried instead.
+        if (offscreenBuffer)
+            OpenGL::stencilBits = stencilBits;
+        else if (rebuild)
+            OpenGL::stencilBits = OpenGL::getCapabilities().stencilBits = stencilBits;
+        else
+            OpenGL::stencilBits = OpenGL::getCapabilities().stencilBits;
+        OpenGL::stencilMax = 1 << OpenGL::stencilBits;
+        OpenGL::stencilMask = OpenGL::stencilMax - 1;
+
+        // the buffers of renderProgressive() are recorded at its end, the
+        // shared depth / stencil buffer does not count for the budget
+        if (!offscreenBuffer)
+            OpenGL::useOffscreenBuffer();
 
         mInOffscreenBuffer = false;
         mCurrentChannel = NoChannel;
         mOccupiedChannels = NoChannel;
 
+        // renderProgressive() keeps its results at full resolution. The GLSL
+        // programs for rectangular textures look them up at gl_FragCoord,
+        // which cannot be scaled. Only the GLSL merge programs leave out the
+        // pixels at the edges, which are refined at full resolution later.
+        mResolutionDivisor = 1;
+        if (!offscreenBuffer && !isRectangularTexture() && refinesEdges())
+            mResolutionDivisor = Refinement::divisor;
+
+        if (OpenGL::coreProfile) {
+            OpenGL::uploadMatrices();
+            OpenGL::setInstanceMatrix(0);
+            OpenGL::resetProgram();
+        }
+
         return true;
     }
 
     ChannelManager::~ChannelManager() {
-        glPopAttrib();
+        OpenGL::resolutionDivisor = 1;
+        OpenGL::inTile = false;
+        if (mStateMemo) {
+            mStateMemo->restore();
+            delete mStateMemo;
+        } else {
+            glPopAttrib();
+        }
         assert(gInUse);
         gInUse = false;
     }
@@ -261,7 +289,7 @@ namespace OpenCSG {
         // find free channel
         if ((mOccupiedChannels & Alpha) == 0) {
             channel = Alpha;
-        }  else if (OPENCSG_HAS_EXT(ARB_texture_env_dot3) || GLAD_GL_VERSION_1_3) {
+        }  else if (OpenGL::getCapabilities().textureEnvDot3) {
             if ((mOccupiedChannels & Red) == 0)   {
                 channel = Red;
             } else if ((mOccupiedChannels & Green) == 0) {
@@ -280,6 +308,21 @@ namespace OpenCSG {
 
             mInOffscreenBuffer = true;
 
+            if (mResolutionDivisor > 1) {
+                GLint viewport[4];
+                OpenGL::reducedViewport(mResolutionDivisor, viewport);
+                glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+                OpenGL::resolutionDivisor = mResolutionDivisor;
+            }
+
+            if (OpenGL::tilePos[2] > 0) {
+                // move the canvas such that the tile starts at the origin
+                // of the offscreen buffer
+                glViewport(OpenGL::canvasPos[0] - OpenGL::tilePos[0], OpenGL::canvasPos[1] - OpenGL::tilePos[1],
+                           OpenGL::canvasPos[2], OpenGL::canvasPos[3]);
+                OpenGL::inTile = true;
+            }
+
             mCurrentChannel = NoChannel;
             mOccupiedChannels = NoChannel;
         }
@@ -315,12 +358,34 @@ namespace OpenCSG {
     }
 
     void ChannelManager::free() {
+        discard();
+
+        OPENCSG_STATISTICS(++stats->channelMerges);
+        OPENCSG_STATISTICS_PHASE(MergePhase);
+        OPENCSG_TRACE_SCOPE("ChannelManager.merge", -1);
+        merge();
+
+        if (mResolutionDivisor > 1) {
+            OPENCSG_TRACE_SCOPE("ChannelManager.markEdges", -1);
+            Refinement::markEdges(mOffscreenBuffer);
+        }
+    }
+
+    void ChannelManager::discard() {
         if (mInOffscreenBuffer) {
             mOffscreenBuffer->EndCapture();
             mInOffscreenBuffer = false;
-        }
 
-        merge();
+            if (mResolutionDivisor > 1) {
+                glViewport(OpenGL::canvasPos[0], OpenGL::canvasPos[1], OpenGL::canvasPos[2], OpenGL::canvasPos[3]);
+                OpenGL::resolutionDivisor = 1;
+            }
+
+            if (OpenGL::inTile) {
+                glViewport(OpenGL::canvasPos[0], OpenGL::canvasPos[1], OpenGL::canvasPos[2], OpenGL::canvasPos[3]);
+                OpenGL::inTile = false;
+            }
+        }
     }
 
     void ChannelManager::renderToChannel(bool on) {
@@ -353,10 +418,16 @@ namespace OpenCSG {
     }
 
 
-    void ChannelManager::setupProjectiveTexture(ProjTextureSetup setup, GLint texSizeInv)
+    bool ChannelManager::refinesEdges() const
+    {
+        return false;
+    }
+
+    void ChannelManager::setupProjectiveTexture(ProjTextureSetup setup, GLint texSizeInv, GLint texOffset, GLint texelSize)
     {
         mOffscreenBuffer->Bind();
-        mOffscreenBuffer->EnableTextureTarget();
+        if (!OpenGL::coreProfile)
+            mOffscreenBuffer->EnableTextureTarget();
 
         if (setup == FixedFunction)
         {
@@ -390,6 +461,20 @@ namespace OpenCSG {
             // 0 and dx resp. dy
             float factorX = static_cast<float>(dx);
             float factorY = static_cast<float>(dy);
+            if (mResolutionDivisor > 1) {
+                GLint viewport[4];
+                OpenGL::reducedViewport(mResolutionDivisor, viewport);
+                factorX *= static_cast<float>(viewport[2]) / static_cast<float>((std::max)(OpenGL::canvasPos[2], 1));
+                factorY *= static_cast<float>(viewport[3]) / static_cast<float>((std::max)(OpenGL::canvasPos[3], 1));
+            }
+
+            // while tiling, the offscreen buffer starts at the tile origin
+            float offsetX = 0.0f;
+            float offsetY = 0.0f;
+            if (OpenGL::tilePos[2] > 0) {
+                offsetX = static_cast<float>(OpenGL::canvasPos[0] - OpenGL::tilePos[0]);
+                offsetY = static_cast<float>(OpenGL::canvasPos[1] - OpenGL::tilePos[1]);
+            }
 
             // Otherwise, if the texture rectangle extension is not used:
             // Do not check for the non-power-of-two extension, but simply for
@@ -399,12 +484,14 @@ namespace OpenCSG {
                 // but we must assure only the used part of the texture is taken.
                 factorX /= static_cast<float>(mOffscreenBuffer->GetWidth());
                 factorY /= static_cast<float>(mOffscreenBuffer->GetHeight());
+                offsetX /= static_cast<float>(mOffscreenBuffer->GetWidth());
+                offsetY /= static_cast<float>(mOffscreenBuffer->GetHeight());
             }
 
             float   texCorrect[16] = { factorX, 0.0f, 0.0f, 0.0f,
                                        0.0f, factorY, 0.0f, 0.0f,
                                        0.0f,    0.0f, 1.0f, 0.0f,
-                                       0.0f,    0.0f, 0.0f, 1.0f };
+                                       offsetX, offsetY, 0.0f, 1.0f };
 
             static const float p2ndc[16] = { 0.5f, 0.0f, 0.0f, 0.0f,
                                              0.0f, 0.5f, 0.0f, 0.0f,
@@ -426,10 +513,42 @@ namespace OpenCSG {
             // with the inverse texture size must be set. The value is used
             // in the 2d fragment shader to map pixel coordinates to texture
             // coordinates between 0 and 1.
+            // At reduced resolution, pixel coordinates are additionally
+            // scaled to the reduced viewport.
             if (!isRectangularTexture())
             {
-                glUniform2f(texSizeInv, 1.0f / (std::max)(mOffscreenBuffer->GetWidth(), 1),
-                                        1.0f / (std::max)(mOffscreenBuffer->GetHeight(), 1));
+                float scaleX = 1.0f;
+                float scaleY = 1.0f;
+                if (mResolutionDivisor > 1) {
+                    GLint viewport[4];
+                    OpenGL::reducedViewport(mResolutionDivisor, viewport);
+                    scaleX = static_cast<float>(viewport[2]) / static_cast<float>((std::max)(OpenGL::canvasPos[2], 1));
+                    scaleY = static_cast<float>(viewport[3]) / static_cast<float>((std::max)(OpenGL::canvasPos[3], 1));
+                }
+                glUniform2f(texSizeInv, scaleX / (std::max)(mOffscreenBuffer->GetWidth(), 1),
+                                        scaleY / (std::max)(mOffscreenBuffer->GetHeight(), 1));
+            }
+
+            // The uniform with the texture offset moves pixel coordinates
+            // to the origin of the tile in the offscreen buffer.
+            if (texOffset != -1)
+            {
+                if (OpenGL::tilePos[2] > 0)
+                    glUniform2f(texOffset, static_cast<float>(OpenGL::tilePos[0]), static_cast<float>(OpenGL::tilePos[1]));
+                else
+                    glUniform2f(texOffset, 0.0f, 0.0f);
+            }
+
+            // The uniform with the size of a texel lets the 2d fragment
+            // shader compare the neighbors of the texel at reduced
+            // resolution, and is 0 at full resolution.
+            if (texelSize != -1)
+            {
+                if (mResolutionDivisor > 1)
+                    glUniform2f(texelSize, 1.0f / static_cast<float>((std::max)(mOffscreenBuffer->GetWidth(), 1)),
+                                           1.0f / static_cast<float>((std::max)(mOffscreenBuffer->GetHeight(), 1)));
+                else
+                    glUniform2f(texelSize, 0.0f, 0.0f);
             }
         }
     }
@@ -451,7 +570,8 @@ namespace OpenCSG {
             glMatrixMode(GL_MODELVIEW);
         }
 
-        mOffscreenBuffer->DisableTextureTarget();
+        if (!OpenGL::coreProfile)
+            mOffscreenBuffer->DisableTextureTarget();
     }
 
     void ChannelManager::setupTexEnv(Channel channel) {
@@ -460,7 +580,7 @@ namespace OpenCSG {
             glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
         } else {
             // replicate color into alpha
-            if (OPENCSG_HAS_EXT(ARB_texture_env_dot3) || GLAD_GL_VERSION_1_3) {
+            if (OpenGL::getCapabilities().textureEnvDot3) {
                 switch (channel) {
                 case Red: 
                     glColor3f(1.0f, 0.5f, 0.5f); 
@@ -34,6 +34,7 @@ namespace OpenCSG {
 
     namespace OpenGL {
         class OffscreenBuffer;
+        class StateMemo;
     }
 
     class Primitive;
@@ -56,8 +57,10 @@ namespace OpenCSG {
         virtual ~ChannelManager();
 
         /// initializes the ChannelManager object, i.e., creates the offscreen
-        /// buffer. Returns false on failure. 
-        bool init();
+        /// buffer. Returns false on failure. If offscreenBuffer is given, it
+        /// is used instead of the offscreen buffer shared by all calls of
+        /// render(), and sized exactly to the viewport.
+        bool init(OpenGL::OffscreenBuffer* offscreenBuffer = 0);
 
         /// returns a free channel, or NoChannel if nothings available
         Channel find() const;
@@ -71,6 +74,10 @@ namespace OpenCSG {
         /// releases the offscreen buffer and invokes merge() to transfer
         /// the visibility information into the main canvas.
         void free();
+        /// releases the offscreen buffer without merge(), if the results
+        /// have been rendered into the depth buffer of the main canvas
+        /// directly (see OpenGL::getSharedDepthStencilBuffer()).
+        void discard();
         /// transfers visibility information into the main canvas. 
         /// implemented by subclasses SCSChannelManager and 
         /// GoldfeatherChannelManager
@@ -84,8 +91,13 @@ namespace OpenCSG {
         /// workings depends on whether the fixed function pipeline, an
         /// ARB shader, or a GLSL program is used. texSizeInv is the uniform
         /// location of a 2d-vector that is supposed to take the inverse of
-        /// the texture size. For non-GLSL, texSizeInv is ignored.
-        void setupProjectiveTexture(ProjTextureSetup setup, GLint texSizeInv = -1);
+        /// the texture size. texOffset is the uniform location of a
+        /// 2d-vector that takes the window position of the offscreen buffer
+        /// origin, which is not 0 while tiling. texelSize is the uniform
+        /// location of a 2d-vector that takes the size of a texel at reduced
+        /// resolution, and 0 at full resolution. For non-GLSL, texSizeInv,
+        /// texOffset, and texelSize are ignored.
+        void setupProjectiveTexture(ProjTextureSetup setup, GLint texSizeInv = -1, GLint texOffset = -1, GLint texelSize = -1);
         /// undoes texture settings
         void resetProjectiveTexture(ProjTextureSetup setup);
         /// activate texenv settings such that information in channel is
@@ -94,15 +106,23 @@ namespace OpenCSG {
 
     protected:
         bool isRectangularTexture() const;
+        /// whether merge() leaves out the pixels whose visibility is not
+        /// reliable at reduced resolution, and marks their edges for
+        /// refinement (see refinement.h). Otherwise, the ChannelManager
+        /// computes at full resolution.
+        virtual bool refinesEdges() const;
 
     private:
         ChannelManager(const ChannelManager&);
         ChannelManager& operator=(const ChannelManager&);
 
-        static bool gInUse;
+        static thread_local bool gInUse;
 
         OpenGL::OffscreenBuffer* mOffscreenBuffer;
+        OpenGL::StateMemo* mStateMemo;
         bool mInOffscreenBuffer;
+        /// 1 for full resolution, 2 or 4 for half or quarter resolution
+        int mResolutionDivisor;
 
     protected:
         Channel mCurrentChannel;
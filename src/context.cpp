@@ -24,12 +24,24 @@
 #include "offscreenBuffer.h"
 #include "frameBufferObject.h"
 #include "frameBufferObjectExt.h"
+#include "frameBufferObjectShared.h"
+#include "autoTuner.h"
+#include "gpuTimer.h"
 #include "openglHelper.h"
+#include "programBinaryCache.h"
+#include "progressive.h"
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <string>
+#include <vector>
 
 namespace OpenCSG {
 
-    static int gContext = 0;
+    // the context is selected per thread, such that threads can render
+    // with their own OpenGL contexts at the same time
+    static thread_local int gContext = 0;
 
     /// redeclared from opencsg.h
     void setContext(int context) {
@@ -46,18 +58,203 @@ namespace OpenCSG {
         OpenGL::freeResources();
     }
 
+    /// redeclared from opencsg.h
+    void freeEvictedResources() {
+        OpenGL::releaseEvictedOffscreenBuffers();
+    }
+
+    OffscreenMemoryUsage::OffscreenMemoryUsage() :
+        budget(0),
+        total(0),
+        current(0),
+        evicted(0),
+        contexts(0),
+        evictions(0)
+    {
+    }
+
     namespace OpenGL {
 
+        Capabilities::Capabilities() :
+            coreProfile(false),
+            intel(false),
+            textureRectangle(false),
+            textureEnvDot3(false),
+            rectangularOffscreenBuffers(false),
+            shaderDrawParameters(false),
+            maxTextureSize(0),
+            maxRenderbufferSize(0),
+            stencilBits(0)
+        {
+        }
+
+        namespace {
+
+            // The following implements a heuristic that makes the offscreen buffer
+            // smaller if the size of the buffer has been bigger than necessary
+            // in x- or y- direction for resizeOffscreenBufferLimit frames.
+            //
+            // this permits to use OpenCSG for CSG rendering in different
+            // canvases with different sizes without permanent expensive
+            // resizing of the offscreen buffer for every frame.
+            //
+            // possible improvements:
+            //   - allow the user to define the resizeOffscreenBufferLimit?
+            const int resizeOffscreenBufferLimit = 64;
+
+            // the number of recent views remembered by isViewMoving()
+            const int viewHistoryLength = 64;
+
+            template<int FRAMES>
+            class MaximumMemorizer {
+                int mMax;
+                int mSecondMax;
+                int mCounter;
+            public:
+                MaximumMemorizer() : mMax(0), mSecondMax(-1), mCounter(0) { }
+                void newValue(int v) {
+                    if (v>=mMax) {
+                        mMax = v;
+                        mSecondMax = -1;
+                        mCounter = 0;
+                    } else {
+                        if (v>mSecondMax) {
+                            mSecondMax = v;
+                        }
+                        if (++mCounter >= FRAMES) {
+                            mMax = mSecondMax;
+                            mSecondMax = -1;
+                            mCounter = 0;
+                        }
+                    }
+                }
+                int getMax() const {
+                    return mMax;
+                }
+            };
+
+            std::size_t offscreenBytes(const OffscreenBuffer* buffer) {
+                if (!buffer || !buffer->IsInitialized())
+                    return 0;
+                return static_cast<std::size_t>(buffer->GetWidth())
+                     * static_cast<std::size_t>(buffer->GetHeight()) * offscreenBytesPerPixel;
+            }
+
+        } // unnamed namespace
+
+        // a GLSL program that is still being compiled and linked, maybe in
+        // the background (GL_KHR_parallel_shader_compile)
+        struct PendingProgram {
+            GLuint program;
+            // whether it has been loaded from the program binary cache
+            bool loaded;
+        };
+
         struct ContextData {
-            ContextData() : fARB(0), fEXT(0)
+            ContextData() : fARB(0), fEXT(0), fShared(0), fEdgeMask(0), offscreenBytes(0), lastUse(0), evicted(false), nextView(0), haveCapabilities(false), parallelShaderCompile(-1), vertexArray(0), vertexBuffer(0), matrixBuffer(0), instanceBuffer(0), gpuTimer(0), autoTuner(0), progressiveCache(0)
             {}
             FrameBufferObject* fARB;
             FrameBufferObjectExt* fEXT;
+            // shares the depth / stencil buffer of the application, and does
+            // not count for the memory budget
+            FrameBufferObjectShared* fShared;
+            // marks the edges to be refined, see getEdgeMaskBuffer()
+            FrameBufferObject* fEdgeMask;
+            MaximumMemorizer<resizeOffscreenBufferLimit> sizeX;
+            MaximumMemorizer<resizeOffscreenBufferLimit> sizeY;
+            // memory of fARB, fEXT and the buffers of progressiveCache, as
+            // of the last useOffscreenBuffer()
+            std::size_t offscreenBytes;
+            // value of gUseCounter at the last useOffscreenBuffer()
+            unsigned long lastUse;
+            // whether the offscreen buffers are to be released for the budget
+            bool evicted;
+            // the recent views seen by isViewMoving(), each with the CSG
+            // product rendered, and the next one to replace
+            std::vector<std::pair<std::vector<Primitive*>, std::vector<float> > > views;
+            std::size_t nextView;
             std::map<const char*, GLuint> idFP;
             std::map<const char*, GLuint> idGLSL;
+            std::map<const char*, PendingProgram> pendingGLSL;
+            std::map<GLuint, ProgramUniforms> uniforms;
+            bool haveCapabilities;
+            Capabilities capabilities;
+            int parallelShaderCompile; // -1: not yet determined
+            GLuint vertexArray;
+            GLuint vertexBuffer;
+            GLuint matrixBuffer;
+            GLuint instanceBuffer;
+            GPUTimer* gpuTimer;
+            AutoTuner* autoTuner;
+            Progressive::Cache* progressiveCache;
         };
 
         static std::map<int, ContextData> gContextDataMap;
+        // guards the map itself. The data of a context is accessed by the
+        // thread that currently renders with the context only, and the
+        // elements of a std::map are not moved by other insertions.
+        static std::mutex gContextDataMutex;
+        // incremented whenever data is erased from the map, which
+        // invalidates the data remembered by getContextData()
+        static std::atomic<unsigned int> gContextDataErasures(0);
+
+        // the data of the context the thread has used last, such that the
+        // map is only looked up (with the mutex locked) if the context changes
+        static thread_local ContextData* tLastContextData = 0;
+        static thread_local int tLastContext = 0;
+        static thread_local unsigned int tLastErasures = 0;
+
+        static ContextData& getContextData() {
+            const int context = getContext();
+            const unsigned int erasures = gContextDataErasures.load(std::memory_order_acquire);
+            if (!tLastContextData || tLastContext != context || tLastErasures != erasures) {
+                std::lock_guard<std::mutex> lock(gContextDataMutex);
+                tLastContextData = &gContextDataMap[context];
+                tLastContext = context;
+                tLastErasures = erasures;
+            }
+            return *tLastContextData;
+        }
+
+        // The memory budget of the offscreen buffers of all contexts and the
+        // bookkeeping for evicting them, all guarded by gContextDataMutex.
+        // OpenGL objects can only be deleted in their own context, so an
+        // evicted context releases its offscreen buffers when it is current
+        // next, i.e., at the end of render() or in freeEvictedResources().
+        static std::size_t gOffscreenBudget = 0;
+        static unsigned long gUseCounter = 0;
+        static unsigned int gEvictions = 0;
+
+        // evicts the least recently used contexts other than keep until the
+        // offscreen buffers that are not evicted fit into the budget.
+        // gContextDataMutex must be locked
+        static void enforceOffscreenBudget(const ContextData* keep) {
+            if (gOffscreenBudget == 0)
+                return;
+
+            std::size_t retained = 0;
+            for (std::map<int, ContextData>::const_iterator itr = gContextDataMap.begin(); itr != gContextDataMap.end(); ++itr) {
+                if (!itr->second.evicted)
+                    retained += itr->second.offscreenBytes;
+            }
+
+            while (retained > gOffscreenBudget) {
+                std::map<int, ContextData>::iterator lru = gContextDataMap.end();
+                for (std::map<int, ContextData>::iterator itr = gContextDataMap.begin(); itr != gContextDataMap.end(); ++itr) {
+                    const ContextData& data = itr->second;
+                    if (&data == keep || data.evicted || data.offscreenBytes == 0)
+                        continue;
+                    if (lru == gContextDataMap.end() || data.lastUse < lru->second.lastUse)
+                        lru = itr;
+                }
+                if (lru == gContextDataMap.end())
+                    break;
+
+                lru->second.evicted = true;
+                retained -= lru->second.offscreenBytes;
+                ++gEvictions;
+            }
+        }
 
         void ensureFunctionPointers()
         {
@@ -68,15 +265,12 @@ namespace OpenCSG {
             // When changing from GLEW to glad, it turned out that this had
             // never been correctly considered. So I decided to ignore this
             // potential problem until I get concrete complaints.
-            static bool sHaveOpenGLFunctions = false;
-            if (!sHaveOpenGLFunctions)
-                initExtensionLibrary();
-            sHaveOpenGLFunctions = true;
+            static std::once_flag sHaveOpenGLFunctions;
+            std::call_once(sHaveOpenGLFunctions, initExtensionLibrary);
         }
 
         OffscreenBuffer* getOffscreenBuffer(OffscreenType type) {
-            int context = getContext();
-            ContextData& contextData = gContextDataMap[context];
+            ContextData& contextData = getContextData();
 
             if (type == OpenCSG::FrameBufferObjectARB) {
                 if (!contextData.fARB)
@@ -91,10 +285,232 @@ namespace OpenCSG {
             return 0;
         }
 
+        OffscreenBuffer* getSharedDepthStencilBuffer() {
+            if (getOption(SharedDepthStencilSetting) == 0)
+                return 0;
+
+            ContextData& contextData = getContextData();
+            if (!contextData.fShared)
+                contextData.fShared = new FrameBufferObjectShared;
+            if (!contextData.fShared->ReadCurrent())
+                return 0;
+            return contextData.fShared;
+        }
+
+        OffscreenBuffer* getEdgeMaskBuffer() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.fEdgeMask)
+                contextData.fEdgeMask = new FrameBufferObject;
+            return contextData.fEdgeMask;
+        }
+
+        Dimensions getOffscreenBufferSize(int width, int height) {
+            ContextData& contextData = getContextData();
+
+            // width == height == 0 happens if the window is minimized, in this case don't touch a thing
+            if (width != 0 && height != 0) {
+                contextData.sizeX.newValue(width);
+                contextData.sizeY.newValue(height);
+            }
+
+            return Dimensions(contextData.sizeX.getMax(), contextData.sizeY.getMax());
+        }
+
+        void useOffscreenBuffer() {
+            std::lock_guard<std::mutex> lock(gContextDataMutex);
+            ContextData& contextData = gContextDataMap[getContext()];
+
+            contextData.offscreenBytes = offscreenBytes(contextData.fARB) + offscreenBytes(contextData.fEXT);
+            if (contextData.progressiveCache)
+                contextData.offscreenBytes += contextData.progressiveCache->bytes();
+            contextData.lastUse = ++gUseCounter;
+            contextData.evicted = false;
+
+            enforceOffscreenBudget(&contextData);
+        }
+
+        void releaseEvictedOffscreenBuffers() {
+            FrameBufferObject* fARB = 0;
+            FrameBufferObjectExt* fEXT = 0;
+            Progressive::Cache* progressiveCache = 0;
+            {
+                std::lock_guard<std::mutex> lock(gContextDataMutex);
+                std::map<int, ContextData>::iterator itr = gContextDataMap.find(getContext());
+                if (itr == gContextDataMap.end() || !itr->second.evicted)
+                    return;
+
+                ContextData& contextData = itr->second;
+                fARB = contextData.fARB;
+                fEXT = contextData.fEXT;
+                progressiveCache = contextData.progressiveCache;
+                contextData.fARB = 0;
+                contextData.fEXT = 0;
+                contextData.progressiveCache = 0;
+                contextData.offscreenBytes = 0;
+                contextData.evicted = false;
+            }
+
+            delete fARB;
+            delete fEXT;
+            delete progressiveCache;
+        }
+
+        static void determineCapabilities(Capabilities& caps) {
+            if (GLAD_GL_VERSION_3_2) {
+                GLint profileMask = 0;
+                glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profileMask);
+                if (profileMask & GL_CONTEXT_CORE_PROFILE_BIT)
+                    caps.coreProfile = true;
+            }
+            if (GLAD_GL_VERSION_3_0) {
+                // forward-compatible contexts lack the fixed function
+                // pipeline as well, also with OpenGL 3.0 and 3.1
+                GLint contextFlags = 0;
+                glGetIntegerv(GL_CONTEXT_FLAGS, &contextFlags);
+                if (contextFlags & GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT)
+                    caps.coreProfile = true;
+            }
+
+            if (const char* vendor = (const char*)glGetString(GL_VENDOR))
+                caps.intel = std::string(vendor).find("Intel") == 0;
+
+            caps.textureRectangle =    OPENCSG_HAS_EXT(ARB_texture_rectangle)
+                                    || OPENCSG_HAS_EXT(EXT_texture_rectangle)
+                                    || OPENCSG_HAS_EXT(NV_texture_rectangle);
+            caps.textureEnvDot3 = OPENCSG_HAS_EXT(ARB_texture_env_dot3) || GLAD_GL_VERSION_1_3;
+            caps.rectangularOffscreenBuffers =    !GLAD_GL_VERSION_3_0
+                                               && !OPENCSG_HAS_EXT(ARB_texture_non_power_of_two)
+                                               && caps.textureRectangle;
+
+            // not known to glad, so looked up in the extension string
+            if (GLAD_GL_VERSION_3_0) {
+                GLint extensions = 0;
+                glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+                for (GLint i = 0; i < extensions && !caps.shaderDrawParameters; ++i) {
+                    const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+                    caps.shaderDrawParameters = extension && std::string(extension) == "GL_ARB_shader_draw_parameters";
+                }
+            }
+
+            glGetIntegerv(GL_MAX_TEXTURE_SIZE, &caps.maxTextureSize);
+            if (GLAD_GL_VERSION_3_0 || OPENCSG_HAS_EXT(ARB_framebuffer_object) || OPENCSG_HAS_EXT(EXT_framebuffer_object))
+                glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &caps.maxRenderbufferSize);
+        }
+
+        Capabilities& getCapabilities() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.haveCapabilities) {
+                determineCapabilities(contextData.capabilities);
+                contextData.haveCapabilities = true;
+            }
+
+            return contextData.capabilities;
+        }
+
+        bool isCoreProfile() {
+            return getCapabilities().coreProfile;
+        }
+
+        GLuint getCoreVertexArray() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.vertexArray) {
+                GLint oldVertexArray = 0;
+                GLint oldArrayBuffer = 0;
+                glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVertexArray);
+                glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldArrayBuffer);
+
+                glGenVertexArrays(1, &contextData.vertexArray);
+                glGenBuffers(1, &contextData.vertexBuffer);
+                glBindVertexArray(contextData.vertexArray);
+                glBindBuffer(GL_ARRAY_BUFFER, contextData.vertexBuffer);
+                glEnableVertexAttribArray(0);
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+                glBindVertexArray(oldVertexArray);
+                glBindBuffer(GL_ARRAY_BUFFER, oldArrayBuffer);
+            }
+
+            return contextData.vertexArray;
+        }
+
+        GLuint getCoreVertexBuffer() {
+            getCoreVertexArray();
+            return getContextData().vertexBuffer;
+        }
+
+        GLuint getMatrixUniformBuffer() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.matrixBuffer) {
+                glGenBuffers(1, &contextData.matrixBuffer);
+            }
+
+            return contextData.matrixBuffer;
+        }
+
+        GLuint getInstanceBuffer() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.instanceBuffer) {
+                glGenBuffers(1, &contextData.instanceBuffer);
+            }
+
+            return contextData.instanceBuffer;
+        }
+
+        bool isViewMoving(const std::vector<Primitive*>& primitives) {
+            ContextData& contextData = getContextData();
+
+            std::pair<std::vector<Primitive*>, std::vector<float> > view;
+            view.first = primitives;
+            view.second.assign(modelview, modelview + 16);
+            view.second.insert(view.second.end(), projection, projection + 16);
+            view.second.insert(view.second.end(), canvasPos, canvasPos + 4);
+            if (std::find(contextData.views.begin(), contextData.views.end(), view) != contextData.views.end())
+                return false;
+
+            if (contextData.views.size() < static_cast<std::size_t>(viewHistoryLength)) {
+                contextData.views.push_back(view);
+            } else {
+                contextData.views[contextData.nextView].swap(view);
+                contextData.nextView = (contextData.nextView + 1) % viewHistoryLength;
+            }
+            return true;
+        }
+
+        GPUTimer* getGPUTimer() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.gpuTimer)
+                contextData.gpuTimer = new GPUTimer;
+
+            return contextData.gpuTimer;
+        }
+
+        AutoTuner* getAutoTuner() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.autoTuner)
+                contextData.autoTuner = new AutoTuner;
+
+            return contextData.autoTuner;
+        }
+
+        Progressive::Cache* getProgressiveCache() {
+            ContextData& contextData = getContextData();
+
+            if (!contextData.progressiveCache)
+                contextData.progressiveCache = new Progressive::Cache;
+
+            return contextData.progressiveCache;
+        }
+
         static GLuint getARBProgram(GLenum target, const char* prog, int len)
         {
-            int context = getContext();
-            ContextData& contextData = gContextDataMap[context];
+            ContextData& contextData = getContextData();
 
             std::map<const char*, GLuint>::iterator it = contextData.idFP.find(prog);
             if (it == contextData.idFP.end())
@@ -153,22 +569,63 @@ namespace OpenCSG {
             return getGLSLShader(GL_FRAGMENT_SHADER, prog);
         }
 
-        GLuint getGLSLProgram(const char* programId, const char* vertexProg, const char* fragmentProg)
+        // starts building the GLSL program, which completes in the background
+        // if the driver compiles in parallel
+        static PendingProgram startGLSLProgram(ContextData& contextData, const char* vertexProg, const char* fragmentProg)
         {
-            int context = getContext();
-            ContextData& contextData = gContextDataMap[context];
+            if (contextData.parallelShaderCompile == -1) {
+                contextData.parallelShaderCompile = OPENCSG_HAS_EXT(KHR_parallel_shader_compile) ? 1 : 0;
+                if (contextData.parallelShaderCompile)
+                    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF); // as many as the driver likes
+            }
 
-            std::map<const char*, GLuint>::iterator it = contextData.idGLSL.find(programId);
-            if (it == contextData.idGLSL.end())
-            {
+            PendingProgram pending;
+            pending.program = glCreateProgram();
+            pending.loaded = loadProgramBinary(pending.program, vertexProg, fragmentProg);
+            if (!pending.loaded) {
                 GLuint vertexShader = getGLSLVertexShader(vertexProg);
                 GLuint fragmentShader = getGLSLFragmentShader(fragmentProg);
-                GLuint shaderProgram = glCreateProgram();
-                glAttachShader(shaderProgram, vertexShader);
-                glAttachShader(shaderProgram, fragmentShader);
-                glLinkProgram(shaderProgram);
+                glAttachShader(pending.program, vertexShader);
+                glAttachShader(pending.program, fragmentShader);
+                glLinkProgram(pending.program);
                 glDeleteShader(vertexShader);
                 glDeleteShader(fragmentShader);
+            }
+
+            return pending;
+        }
+
+        GLuint getGLSLProgram(const char* programId, const char* vertexProg, const char* fragmentProg, bool wait)
+        {
+            ContextData& contextData = getContextData();
+
+            std::map<const char*, GLuint>::iterator it = contextData.idGLSL.find(programId);
+            if (it == contextData.idGLSL.end())
+            {
+                std::map<const char*, PendingProgram>::iterator pending = contextData.pendingGLSL.find(programId);
+                if (pending == contextData.pendingGLSL.end())
+                    pending = contextData.pendingGLSL.insert(std::make_pair(programId, startGLSLProgram(contextData, vertexProg, fragmentProg))).first;
+
+                GLuint shaderProgram = pending->second.program;
+                if (!wait && contextData.parallelShaderCompile == 1) {
+                    GLint completed = GL_FALSE;
+                    glGetProgramiv(shaderProgram, GL_COMPLETION_STATUS_KHR, &completed);
+                    if (!completed)
+                        return 0;
+                }
+
+                // from here on, the program is waited for
+                if (!pending->second.loaded)
+                    storeProgramBinary(shaderProgram, vertexProg, fragmentProg);
+                contextData.pendingGLSL.erase(pending);
+
+                if (GLAD_GL_VERSION_3_1) {
+                    GLuint matrices = glGetUniformBlockIndex(shaderProgram, "OpenCSGMatrices");
+                    if (matrices != GL_INVALID_INDEX)
+                        glUniformBlockBinding(shaderProgram, matrices, matrixUniformBufferBinding);
+                }
+
+                getGLSLProgramUniforms(shaderProgram);
 
                 it = contextData.idGLSL.insert(std::pair<const char*, GLuint>(programId, shaderProgram)).first;
             }
@@ -176,32 +633,116 @@ namespace OpenCSG {
             return it->second;
         }
 
+        const ProgramUniforms& getGLSLProgramUniforms(GLuint program)
+        {
+            ContextData& contextData = getContextData();
+
+            std::map<GLuint, ProgramUniforms>::iterator it = contextData.uniforms.find(program);
+            if (it == contextData.uniforms.end())
+            {
+                ProgramUniforms uniforms;
+                uniforms.color = glGetUniformLocation(program, "color");
+                uniforms.texSizeInv = glGetUniformLocation(program, "texSizeInv");
+                uniforms.texOffset = glGetUniformLocation(program, "texOffset");
+                uniforms.texelSize = glGetUniformLocation(program, "texelSize");
+                uniforms.depthTexture = glGetUniformLocation(program, "depthTexture");
+                uniforms.idBase = glGetUniformLocation(program, "idBase");
+                uniforms.idPerDraw = glGetUniformLocation(program, "idPerDraw");
+
+                it = contextData.uniforms.insert(std::make_pair(program, uniforms)).first;
+            }
+
+            return it->second;
+        }
+
         void freeResources()
         {
-            int context = getContext();
-            std::map<int, ContextData>::iterator itr = gContextDataMap.find(context);
-            if (itr != gContextDataMap.end())
+            ContextData contextData;
             {
-                delete itr->second.fARB;
-                delete itr->second.fEXT;
+                std::lock_guard<std::mutex> lock(gContextDataMutex);
+                std::map<int, ContextData>::iterator itr = gContextDataMap.find(getContext());
+                if (itr == gContextDataMap.end())
+                    return;
+                contextData = itr->second;
+                gContextDataMap.erase(itr);
+                gContextDataErasures.fetch_add(1, std::memory_order_release);
+            }
+
+            delete contextData.fARB;
+            delete contextData.fEXT;
+            delete contextData.fShared;
+            delete contextData.fEdgeMask;
+            {
+                std::map<const char*, GLuint> & idFP = contextData.idFP;
+                for (std::map<const char*, GLuint>::iterator it = idFP.begin(); it != idFP.end(); ++it)
                 {
-                    std::map<const char*, GLuint> & idFP = itr->second.idFP;
-                    for (std::map<const char*, GLuint>::iterator it = idFP.begin(); it != idFP.end(); ++it)
-                    {
-                        glDeleteProgramsARB(1, &(it->second));
-                    }
+                    glDeleteProgramsARB(1, &(it->second));
                 }
+            }
+            {
+                std::map<const char*, GLuint> & idGLSL = contextData.idGLSL;
+                for (std::map<const char*, GLuint>::iterator it = idGLSL.begin(); it != idGLSL.end(); ++it)
                 {
-                    std::map<const char*, GLuint> & idGLSL = itr->second.idGLSL;
-                    for (std::map<const char*, GLuint>::iterator it = idGLSL.begin(); it != idGLSL.end(); ++it)
-                    {
-                        glDeleteProgram(it->second);
-                    }
+                    glDeleteProgram(it->second);
                 }
-                gContextDataMap.erase(itr);
             }
+            {
+                std::map<const char*, PendingProgram> & pendingGLSL = contextData.pendingGLSL;
+                for (std::map<const char*, PendingProgram>::iterator it = pendingGLSL.begin(); it != pendingGLSL.end(); ++it)
+                {
+                    glDeleteProgram(it->second.program);
+                }
+            }
+            if (contextData.vertexArray) {
+                glDeleteVertexArrays(1, &(contextData.vertexArray));
+                glDeleteBuffers(1, &(contextData.vertexBuffer));
+            }
+            if (contextData.matrixBuffer) {
+                glDeleteBuffers(1, &(contextData.matrixBuffer));
+            }
+            if (contextData.instanceBuffer) {
+                glDeleteBuffers(1, &(contextData.instanceBuffer));
+            }
+            delete contextData.gpuTimer;
+            delete contextData.autoTuner;
+            delete contextData.progressiveCache;
         }
 
     } // namespace OpenGL
 
+    /// redeclared from opencsg.h
+    void setOffscreenMemoryBudget(std::size_t bytes) {
+        std::lock_guard<std::mutex> lock(OpenGL::gContextDataMutex);
+        OpenGL::gOffscreenBudget = bytes;
+        OpenGL::enforceOffscreenBudget(0);
+    }
+
+    /// redeclared from opencsg.h
+    std::size_t getOffscreenMemoryBudget() {
+        std::lock_guard<std::mutex> lock(OpenGL::gContextDataMutex);
+        return OpenGL::gOffscreenBudget;
+    }
+
+    /// redeclared from opencsg.h
+    OffscreenMemoryUsage getOffscreenMemoryUsage() {
+        std::lock_guard<std::mutex> lock(OpenGL::gContextDataMutex);
+
+        OffscreenMemoryUsage usage;
+        usage.budget = OpenGL::gOffscreenBudget;
+        usage.evictions = OpenGL::gEvictions;
+        for (std::map<int, OpenGL::ContextData>::const_iterator itr = OpenGL::gContextDataMap.begin(); itr != OpenGL::gContextDataMap.end(); ++itr) {
+            const OpenGL::ContextData& data = itr->second;
+            if (data.offscreenBytes == 0)
+                continue;
+            usage.total += data.offscreenBytes;
+            if (itr->first == getContext())
+                usage.current = data.offscreenBytes;
+            if (data.evicted)
+                usage.evicted += data.offscreenBytes;
+            ++usage.contexts;
+        }
+
+        return usage;
+    }
+
 } // namespace OpenCSG
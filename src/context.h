@@ -27,6 +27,8 @@
 #include "opencsgConfig.h"
 #include <opencsg.h>
 #include "openglExt.h"
+#include "offscreenBuffer.h"
+#include <cstddef>
 
 namespace OpenCSG {
 
@@ -37,9 +39,18 @@ namespace OpenCSG {
     /// redeclared from opencsg.h
     void freeResources();
 
+    namespace Progressive {
+        class Cache;
+    }
+
     namespace OpenGL {
 
-        class OffscreenBuffer;
+        class AutoTuner;
+        class GPUTimer;
+
+        /// Memory per pixel of an offscreen buffer: RGBA8 color and
+        /// packed depth / stencil.
+        const std::size_t offscreenBytesPerPixel = 8;
 
         /// Retrieves the OpenGL function pointers, including the
         /// functions pointers of OpenGL extensions, from the
@@ -51,6 +62,37 @@ namespace OpenCSG {
         /// active context in OpenCSG.
         OffscreenBuffer* getOffscreenBuffer(OffscreenType type);
 
+        /// Returns an offscreen buffer that renders into the depth / stencil
+        /// attachment of the frame buffer object currently bound by the
+        /// application, for the currently active context in OpenCSG. Returns
+        /// 0 if the SharedDepthStencilSetting is off or if the attachment
+        /// cannot be shared.
+        OffscreenBuffer* getSharedDepthStencilBuffer();
+
+        /// Returns the offscreen buffer that marks the edges of the CSG
+        /// product computed at reduced resolution (see refinement.h), for
+        /// the currently active context in OpenCSG. It is tiny and does
+        /// not count for the memory budget.
+        OffscreenBuffer* getEdgeMaskBuffer();
+
+        /// Returns the size the offscreen buffer of the currently active
+        /// context should have, given that width x height pixels are
+        /// requested now. The buffer is only made smaller once smaller
+        /// sizes have been requested for a while.
+        Dimensions getOffscreenBufferSize(int width, int height);
+
+        /// Records the offscreen buffers of the currently active context
+        /// as most recently used, together with their memory, which
+        /// includes the buffers kept by renderProgressive(). If the
+        /// memory budget is exceeded, the buffers of the least recently
+        /// used other contexts are evicted.
+        void useOffscreenBuffer();
+
+        /// Releases the offscreen buffers of the currently active context
+        /// if they have been evicted, and the progress of renderProgressive()
+        /// with them.
+        void releaseEvictedOffscreenBuffers();
+
         /// Given a constant(!) ARB vertex program string and its length,
         /// returns a ARB vertex program object, for the currently
         /// active context in OpenCSG.
@@ -67,8 +109,106 @@ namespace OpenCSG {
 
         /// Given a constant(!), null-terminated vertex and fragment
         /// program strings, returns a GLSL program object, for the
-        /// currently active context in OpenCSG.
-        GLuint getGLSLProgram(const char* programId, const char* vertexShader, const char* fragmentShader);
+        /// currently active context in OpenCSG. If the driver compiles
+        /// in parallel (GL_KHR_parallel_shader_compile) and wait is false,
+        /// returns 0 while the program is still being built in the
+        /// background, which is started by the first call.
+        GLuint getGLSLProgram(const char* programId, const char* vertexShader, const char* fragmentShader, bool wait = true);
+
+        /// Locations of the uniforms of a GLSL program that are set while
+        /// rendering, -1 if the program does not have the uniform.
+        struct ProgramUniforms {
+            GLint color;
+            GLint texSizeInv;
+            GLint texOffset;
+            GLint texelSize;
+            GLint depthTexture;
+            GLint idBase;
+            GLint idPerDraw;
+        };
+
+        /// Returns the uniform locations of a GLSL program returned by
+        /// getGLSLProgram(), for the currently active context in OpenCSG.
+        /// They are queried once, when the program has been built.
+        const ProgramUniforms& getGLSLProgramUniforms(GLuint program);
+
+        /// Properties of the OpenGL context that the rendering depends on.
+        /// They are determined once per OpenCSG context, such that render()
+        /// does not query OpenGL for them again and again.
+        struct Capabilities {
+            Capabilities();
+            /// see isCoreProfile()
+            bool coreProfile;
+            /// whether GL_VENDOR starts with "Intel"
+            bool intel;
+            /// whether texture rectangles are available
+            bool textureRectangle;
+            /// whether GL_ARB_texture_env_dot3 (or OpenGL 1.3) is available,
+            /// such that the RGB channels can be used for the IDs, too
+            bool textureEnvDot3;
+            /// whether the offscreen buffers are rectangular textures,
+            /// which is the case if textures of non-power-of-two size are
+            /// not available
+            bool rectangularOffscreenBuffers;
+            /// whether GL_ARB_shader_draw_parameters is available, such
+            /// that the ID of each draw of a multi-draw call can be derived
+            /// from gl_DrawIDARB
+            bool shaderDrawParameters;
+            /// GL_MAX_TEXTURE_SIZE
+            GLint maxTextureSize;
+            /// GL_MAX_RENDERBUFFER_SIZE, 0 without frame buffer objects
+            GLint maxRenderbufferSize;
+            /// number of stencil bits in the offscreen buffer, 0 until
+            /// the offscreen buffer has been built
+            GLint stencilBits;
+        };
+
+        /// Returns the capabilities of the currently active context in
+        /// OpenCSG. The stencil bits are updated by the ChannelManager.
+        Capabilities& getCapabilities();
+
+        /// Returns whether the current OpenGL context is a core profile
+        /// context (or a forward-compatible context), in which the fixed
+        /// function pipeline is not available. The result is determined
+        /// once per OpenCSG context.
+        bool isCoreProfile();
+
+        /// Returns a vertex array object with a single vertex buffer
+        /// (getCoreVertexBuffer()) holding 2d positions at attribute
+        /// location 0, for drawing quads in a core profile context.
+        GLuint getCoreVertexArray();
+
+        /// Returns the vertex buffer used by the vertex array object
+        /// from getCoreVertexArray().
+        GLuint getCoreVertexBuffer();
+
+        /// Returns a uniform buffer object for the uniform block
+        /// OpenCSGMatrices, for the currently active context in OpenCSG.
+        GLuint getMatrixUniformBuffer();
+
+        /// Returns a buffer object for the transformations of the instances
+        /// of an InstancedPrimitive, for the currently active context in OpenCSG.
+        GLuint getInstanceBuffer();
+
+        /// Returns whether the view, i.e., the modelview and projection
+        /// matrix and the viewport as fetched by fetchMatrices(), differs
+        /// from the views the CSG product of the primitives has been rendered
+        /// with in the last calls for the currently active context in OpenCSG.
+        /// Several CSG products, with the same or with different modelview
+        /// matrices, may be rendered per frame, so the view is remembered
+        /// per product, and the camera is only considered as moving if the
+        /// product has not recently been rendered with this view.
+        bool isViewMoving(const std::vector<Primitive*>& primitives);
+
+        /// Returns the GPU timer for the currently active context in OpenCSG.
+        GPUTimer* getGPUTimer();
+
+        /// Returns the auto-tuner for the currently active context in OpenCSG.
+        AutoTuner* getAutoTuner();
+
+        /// Returns the progress of renderProgressive() for the currently
+        /// active context in OpenCSG.
+        Progressive::Cache* getProgressiveCache();
 
         /// Frees all resources (offscreen buffers, fragment programs...)
         /// allocated for the currently active context in OpenCSG.
@@ -0,0 +1,377 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// costModel.cpp
+//
+// The cost model counts the units of work that each combination of
+// Algorithm and DepthComplexityAlgorithm performs for the given screen
+// space layout of the primitives: primitives rendered, fragments of their
+// bounding boxes rasterized, layers or subtraction steps with their state
+// changes, clears and merges, occlusion queries read back, and pixels read
+// back for depth complexity sampling. Each unit has a cost in milliseconds,
+// fitted to the frame times of all scenes and settings of opencsgbench.
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "area.h"
+#include "batch.h"
+#include "context.h"
+#include "costModel.h"
+#include "instance.h"
+#include "occlusionQuery.h"
+#include "openglHelper.h"
+#include "primitiveHelper.h"
+#include "projection.h"
+#include "sequencer.h"
+#include "settings.h"
+#include <algorithm>
+
+namespace OpenCSG {
+
+    CostEstimate::CostEstimate() :
+        primitives(0),
+        intersected(0),
+        subtracted(0),
+        convexity(0),
+        batches(0),
+        subtractedBatches(0),
+        depthComplexity(0),
+        subtractedDepthComplexity(0),
+        intersectedArea(0.0),
+        primitiveArea(0.0)
+    {
+        for (int a = 0; a < Algo::algorithmCount; ++a) {
+            for (int d = 0; d < Algo::depthComplexityAlgorithmCount; ++d) {
+                milliseconds[a][d] = -1.0;
+            }
+        }
+    }
+
+    void estimateCosts(const std::vector<Primitive*>& primitives, CostEstimate& estimate) {
+        OpenGL::ensureFunctionPointers();
+        InstanceExpansion expansion(primitives);
+        OpenGL::fetchMatrices();
+        Algo::projectBoundingBoxes(expansion.getPrimitives());
+        Algo::estimateCosts(expansion.getPrimitives(), estimate);
+    }
+
+    namespace Algo {
+
+        namespace {
+
+            // costs in milliseconds, fitted to opencsgbench at 256x256 pixels
+            // on Mesa llvmpipe. There, the costs of passes and occlusion
+            // queries are hidden by those of rendering primitives; they are
+            // set to small values such that fewer passes win in case of doubt.
+            const double callCost          = 1.0e-1;  // per rendered primitive
+            const double fragmentCost      = 1.5e-5;  // per pixel of a rendered bounding box
+            const double passCost          = 1.0e-2;  // per layer or subtraction step
+            const double passPixelCost     = 1.0e-6;  // per pixel of a layer
+            const double queryCost         = 1.0e-2;  // per occlusion query read back
+            const double readbackPixelCost = 2.7e-5;  // per pixel read back
+
+            // the range of the scenes of opencsgbench the costs are fitted
+            // to. Beyond, the costs are not estimated, which also saves
+            // the batching of the primitives, which is quadratic in their
+            // number, and the Automatic setting chooses by convexity.
+            const unsigned int maxFittedPrimitives = 64;
+            const unsigned int maxFittedDepthComplexity = 16;
+
+            // rounds of the SCS subtraction with occlusion queries, which
+            // stops after a round without changes. In opencsgbench, a single
+            // round with changes suffices even where many subtracted
+            // primitives overlap, since the first round already moves the
+            // depth of most pixels to its final value.
+            const double maxOcclusionQueryRounds = 3.0;
+
+            struct Work {
+                Work() : calls(0.0), fragments(0.0), passes(0.0), passPixels(0.0), queries(0.0), readbackPixels(0.0) {}
+
+                double milliseconds() const {
+                    return calls * callCost
+                         + fragments * fragmentCost
+                         + passes * passCost
+                         + passPixels * passPixelCost
+                         + queries * queryCost
+                         + readbackPixels * readbackPixelCost;
+                }
+
+                double calls;
+                double fragments;
+                double passes;
+                double passPixels;
+                double queries;
+                double readbackPixels;
+            };
+
+            // the bounding box of primitive in normalized device coordinates,
+            // clipped to clip. Returns false if it is empty.
+            bool clippedBox(const Primitive* primitive, const NDCVolume& clip, NDCVolume& box) {
+                primitive->getBoundingBox(box.minx, box.miny, box.minz, box.maxx, box.maxy, box.maxz);
+                box.minx = (std::max)(box.minx, clip.minx);
+                box.miny = (std::max)(box.miny, clip.miny);
+                box.maxx = (std::min)(box.maxx, clip.maxx);
+                box.maxy = (std::min)(box.maxy, clip.maxy);
+                return box.minx < box.maxx && box.miny < box.maxy;
+            }
+
+            double pixels(const NDCVolume& box) {
+                if (box.minx >= box.maxx || box.miny >= box.maxy)
+                    return 0.0;
+                return 0.25 * (box.maxx - box.minx) * static_cast<double>(OpenGL::canvasPos[2])
+                            * (box.maxy - box.miny) * static_cast<double>(OpenGL::canvasPos[3]);
+            }
+
+            // the bounding box of the batch clipped to clip, and the
+            // sum of the clipped boxes of its primitives, in pixels
+            void batchArea(const Batch& batch, const NDCVolume& clip, double& area, double& sum) {
+                NDCVolume bounds(1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f);
+                sum = 0.0;
+                for (Batch::const_iterator itr = batch.begin(); itr != batch.end(); ++itr) {
+                    NDCVolume box;
+                    if (!clippedBox(*itr, clip, box))
+                        continue;
+                    sum += pixels(box);
+                    bounds.minx = (std::min)(bounds.minx, box.minx);
+                    bounds.miny = (std::min)(bounds.miny, box.miny);
+                    bounds.maxx = (std::max)(bounds.maxx, box.maxx);
+                    bounds.maxy = (std::max)(bounds.maxy, box.maxy);
+                }
+                area = pixels(bounds);
+            }
+
+        } // unnamed namespace
+
+        void estimateCosts(const std::vector<Primitive*>& primitives, CostEstimate& estimate) {
+
+            estimate = CostEstimate();
+
+            // the area covered by all intersected primitives
+            NDCVolume intersection(-1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 1.0f);
+            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+                if ((*itr)->getOperation() == Intersection) {
+                    NDCVolume box;
+                    clippedBox(*itr, intersection, box);
+                    intersection.minx = box.minx; intersection.miny = box.miny;
+                    intersection.maxx = box.maxx; intersection.maxy = box.maxy;
+                }
+            }
+            const double intersectedArea = pixels(intersection);
+            estimate.intersectedArea = intersectedArea;
+
+            double intersectedSum = 0.0;
+            double subtractedSum = 0.0;
+            std::vector<Primitive*> visible;          visible.reserve(primitives.size());
+            std::vector<Primitive*> subtracted;       subtracted.reserve(primitives.size());
+            std::vector<NDCVolume> boxes;             boxes.reserve(primitives.size());
+            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+                NDCVolume box;
+                if (!clippedBox(*itr, intersection, box))
+                    continue;
+                visible.push_back(*itr);
+                boxes.push_back(box);
+                estimate.convexity = (std::max)(estimate.convexity, (*itr)->getConvexity());
+                if ((*itr)->getOperation() == Intersection) {
+                    ++estimate.intersected;
+                    intersectedSum += pixels(box);
+                } else {
+                    ++estimate.subtracted;
+                    subtractedSum += pixels(box);
+                    subtracted.push_back(*itr);
+                }
+            }
+            estimate.primitives = static_cast<unsigned int>(visible.size());
+            estimate.primitiveArea = intersectedSum + subtractedSum;
+
+            // depth complexity at the centers of (up to 64) boxes
+            const std::size_t numberOfBoxes = boxes.size();
+            const std::size_t stride = numberOfBoxes / 64 + 1;
+            for (std::size_t i = 0; i < numberOfBoxes; i += stride) {
+                const float x = 0.5f * (boxes[i].minx + boxes[i].maxx);
+                const float y = 0.5f * (boxes[i].miny + boxes[i].maxy);
+                unsigned int all = 0;
+                unsigned int sub = 0;
+                for (std::size_t j = 0; j < numberOfBoxes; ++j) {
+                    if (boxes[j].minx <= x && x <= boxes[j].maxx && boxes[j].miny <= y && y <= boxes[j].maxy) {
+                        const unsigned int convexity = visible[j]->getConvexity();
+                        all += convexity;
+                        if (visible[j]->getOperation() == Subtraction)
+                            sub += convexity;
+                    }
+                }
+                estimate.depthComplexity = (std::max)(estimate.depthComplexity, all);
+                estimate.subtractedDepthComplexity = (std::max)(estimate.subtractedDepthComplexity, sub);
+            }
+
+            if (!inFittedRange(estimate))
+                return;
+
+            const double n = static_cast<double>(estimate.primitives);
+            const double area = estimate.primitiveArea;
+            const bool haveQueries = OpenGL::haveHardwareOcclusionQueries();
+
+            // Goldfeather: one layer per batch and convexity, each with
+            // a parity test of all primitives in the area of the batch
+            {
+                Batcher batcher(visible);
+                estimate.batches = static_cast<unsigned int>(batcher.size());
+
+                Work work;
+                for (std::vector<Batch>::const_iterator itr = batcher.begin(); itr != batcher.end(); ++itr) {
+                    const double layers = static_cast<double>(getConvexity(*itr));
+                    double batchBounds, batchSum;
+                    batchArea(*itr, intersection, batchBounds, batchSum);
+                    work.calls += layers * (static_cast<double>(itr->size()) + n);
+                    work.fragments += layers * (batchSum + (std::min)(area, n * batchBounds));
+                    work.passes += layers;
+                    work.passPixels += layers * batchBounds;
+                }
+                estimate.milliseconds[Goldfeather][NoDepthComplexitySampling] = work.milliseconds();
+            }
+
+            // Goldfeather with occlusion queries: all primitives per layer,
+            // until a layer is empty
+            if (haveQueries) {
+                const double layers = static_cast<double>(estimate.depthComplexity) + 1.0;
+                Work work;
+                work.calls = 2.0 * n * layers;
+                work.fragments = 2.0 * area * layers;
+                work.passes = layers;
+                work.passPixels = intersectedArea * layers;
+                work.queries = layers;
+                estimate.milliseconds[Goldfeather][OcclusionQuery] = work.milliseconds();
+            }
+
+            // Goldfeather with depth complexity sampling: as many layers
+            // as the depth complexity, which must be read back first
+            {
+                const double layers = static_cast<double>(estimate.depthComplexity);
+                Work work;
+                work.calls = n + 2.0 * n * layers;
+                work.fragments = area + 2.0 * area * layers;
+                work.passes = 1.0 + layers;
+                work.passPixels = intersectedArea * layers;
+                work.readbackPixels = intersectedArea;
+                estimate.milliseconds[Goldfeather][DepthComplexitySampling] = work.milliseconds();
+            }
+
+            // SCS: for convex primitives only. The intersected primitives
+            // are rendered three times, the batches of subtracted primitives
+            // twice per subtraction step, or three times if the camera may be
+            // inside of the CSG product.
+            if (estimate.convexity <= 1) {
+                Batcher batcher(subtracted);
+                const std::size_t numberOfBatches = batcher.size();
+                estimate.subtractedBatches = static_cast<unsigned int>(numberOfBatches);
+
+                const double renderings = getOption(CameraOutsideOptimization) == OptimizationOff ? 3.0 : 2.0;
+                const double callsPerStep = numberOfBatches > 0
+                    ? renderings * static_cast<double>(estimate.subtracted) / static_cast<double>(numberOfBatches) : 0.0;
+                const double fragmentsPerStep = numberOfBatches > 0
+                    ? renderings * subtractedSum / static_cast<double>(numberOfBatches) : 0.0;
+
+                Work intersect;
+                intersect.calls = 3.0 * static_cast<double>(estimate.intersected);
+                intersect.fragments = 3.0 * intersectedSum;
+                intersect.passes = 3.0;
+                intersect.passPixels = 3.0 * intersectedArea;
+
+                const std::size_t subtractedDepthComplexity =
+                    (std::min)(static_cast<std::size_t>(estimate.subtractedDepthComplexity), numberOfBatches);
+
+                // With occlusion queries, the subtraction stops after a round
+                // without changes. The depth complexity from the bounding boxes
+                // overestimates the rounds required before, because on average,
+                // only half of the overlapping primitives are in front, and
+                // most pixels settle in the first round anyway.
+                double steps[depthComplexityAlgorithmCount] = { 0.0, 0.0, 0.0 };
+                if (numberOfBatches > 0) {
+                    const double rounds = (std::min)(0.5 * static_cast<double>(subtractedDepthComplexity) + 1.0, maxOcclusionQueryRounds);
+                    steps[NoDepthComplexitySampling] = static_cast<double>(SchoenfieldSequencer(numberOfBatches).size());
+                    steps[OcclusionQuery] = (std::min)(static_cast<double>(SimpleSequencer(numberOfBatches).size()),
+                                                       static_cast<double>(numberOfBatches) * rounds);
+                    steps[DepthComplexitySampling] = static_cast<double>(BouncingSequencer(numberOfBatches).sizeForDepthComplexity(subtractedDepthComplexity));
+                }
+
+                for (int d = 0; d < depthComplexityAlgorithmCount; ++d) {
+                    if (d == OcclusionQuery && !haveQueries)
+                        continue;
+                    Work work = intersect;
+                    work.calls += steps[d] * callsPerStep;
+                    work.fragments += steps[d] * fragmentsPerStep;
+                    work.passes += steps[d];
+                    if (d == OcclusionQuery) {
+                        work.queries = steps[d];
+                    } else if (d == DepthComplexitySampling) {
+                        work.calls += static_cast<double>(estimate.subtracted);
+                        work.fragments += subtractedSum;
+                        work.passes += 1.0;
+                        work.readbackPixels = intersectedArea;
+                    }
+                    estimate.milliseconds[SCS][d] = work.milliseconds();
+                }
+            }
+        }
+
+        bool inFittedRange(const CostEstimate& estimate) {
+            return estimate.primitives <= maxFittedPrimitives
+                && estimate.depthComplexity <= maxFittedDepthComplexity;
+        }
+
+        void chooseByConvexity(const CostEstimate& estimate,
+                               Algorithm& algorithm,
+                               DepthComplexityAlgorithm& depthComplexityAlgorithm) {
+            algorithm = estimate.convexity >= 2 ? Goldfeather : SCS;
+
+            const bool haveQueries = OpenGL::haveHardwareOcclusionQueries();
+            if (haveQueries && estimate.primitives > 20)
+                depthComplexityAlgorithm = OcclusionQuery;
+            else if (!haveQueries && estimate.primitives > 40)
+                depthComplexityAlgorithm = DepthComplexitySampling;
+            else
+                depthComplexityAlgorithm = NoDepthComplexitySampling;
+        }
+
+        void chooseCheapest(const CostEstimate& estimate,
+                            Algorithm& algorithm,
+                            DepthComplexityAlgorithm& depthComplexityAlgorithm) {
+            if (!inFittedRange(estimate)) {
+                chooseByConvexity(estimate, algorithm, depthComplexityAlgorithm);
+                return;
+            }
+
+            algorithm = Goldfeather;
+            depthComplexityAlgorithm = NoDepthComplexitySampling;
+            double cheapest = estimate.milliseconds[Goldfeather][NoDepthComplexitySampling];
+            for (int a = Goldfeather; a < algorithmCount; ++a) {
+                for (int d = 0; d < depthComplexityAlgorithmCount; ++d) {
+                    const double cost = estimate.milliseconds[a][d];
+                    if (cost >= 0.0 && cost < cheapest) {
+                        cheapest = cost;
+                        algorithm = static_cast<Algorithm>(a);
+                        depthComplexityAlgorithm = static_cast<DepthComplexityAlgorithm>(d);
+                    }
+                }
+            }
+        }
+
+    } // namespace Algo
+
+} // namespace OpenCSG
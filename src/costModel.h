@@ -0,0 +1,70 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// costModel.h
+//
+// estimates the costs of the CSG algorithms for choosing the
+// algorithm automatically
+//
+
+#ifndef __OpenCSG__cost_model_h__
+#define __OpenCSG__cost_model_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include <vector>
+
+namespace OpenCSG {
+
+    namespace Algo {
+
+        /// number of values of Algorithm resp. DepthComplexityAlgorithm,
+        /// i.e., the dimensions of CostEstimate::milliseconds
+        const int algorithmCount = SCS + 1;
+        const int depthComplexityAlgorithmCount = DepthComplexitySampling + 1;
+
+        /// estimates the costs of rendering primitives with all algorithms.
+        /// The current matrices and viewport must have been fetched and the
+        /// bounding boxes in object coordinates projected. Outside of the
+        /// fitted range (see inFittedRange()), only the counts and depth
+        /// complexities are determined, and the costs are left negative.
+        void estimateCosts(const std::vector<Primitive*>& primitives, CostEstimate& estimate);
+
+        /// whether the numbers of primitives and the depth complexity lie
+        /// within the range of the scenes the costs have been fitted to
+        bool inFittedRange(const CostEstimate& estimate);
+
+        /// returns the combination chosen without the cost model: SCS for
+        /// convex and Goldfeather for concave primitives, and a
+        /// DepthComplexityAlgorithm by the number of primitives
+        void chooseByConvexity(const CostEstimate& estimate,
+                               Algorithm& algorithm,
+                               DepthComplexityAlgorithm& depthComplexityAlgorithm);
+
+        /// returns the combination with the lowest estimated cost, or the
+        /// one of chooseByConvexity() outside of the fitted range
+        void chooseCheapest(const CostEstimate& estimate,
+                            Algorithm& algorithm,
+                            DepthComplexityAlgorithm& depthComplexityAlgorithm);
+
+    } // namespace Algo
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__cost_model_h__
@@ -43,7 +43,7 @@ namespace OpenCSG {
 
         bool FrameBufferObject::ReadCurrent()
         {
-            bool haveFBO = OPENCSG_HAS_EXT(ARB_framebuffer_object) != 0;
+            bool haveFBO = OPENCSG_HAS_EXT(ARB_framebuffer_object) != 0 || GLAD_GL_VERSION_3_0 != 0;
 
             if (haveFBO)
                 glGetIntegerv(GL_FRAMEBUFFER_BINDING, &oldFramebufferID);
@@ -53,7 +53,7 @@ namespace OpenCSG {
 
         bool FrameBufferObject::Initialize(Dimensions dims)
         {
-            bool haveFBO = OPENCSG_HAS_EXT(ARB_framebuffer_object) != 0;
+            bool haveFBO = OPENCSG_HAS_EXT(ARB_framebuffer_object) != 0 || GLAD_GL_VERSION_3_0 != 0;
             if (!haveFBO)
                 return false;
 
@@ -66,7 +66,8 @@ namespace OpenCSG {
             glBindFramebuffer(GL_FRAMEBUFFER, framebufferID);
 
             GLenum target = GL_TEXTURE_2D;
-            if (   !OPENCSG_HAS_EXT(ARB_texture_non_power_of_two)
+            if (   !GLAD_GL_VERSION_3_0
+                && !OPENCSG_HAS_EXT(ARB_texture_non_power_of_two)
                 && (   OPENCSG_HAS_EXT(ARB_texture_rectangle)
                     || OPENCSG_HAS_EXT(EXT_texture_rectangle)
                     || OPENCSG_HAS_EXT(NV_texture_rectangle)))
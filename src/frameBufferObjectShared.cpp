@@ -0,0 +1,216 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// frameBufferObjectShared.cpp
+//
+
+#include "opencsgConfig.h"
+#include "frameBufferObjectShared.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        // ctor / dtor
+        FrameBufferObjectShared::FrameBufferObjectShared()
+          : textureID(0),
+            framebufferID(0),
+            oldFramebufferID(0),
+            sharedType(GL_NONE),
+            sharedName(0),
+            sharedLevel(0),
+            attachedType(GL_NONE),
+            attachedName(0),
+            attachedLevel(0),
+            failedName(0),
+            initialized(false)
+        {
+        }
+
+        FrameBufferObjectShared::~FrameBufferObjectShared() {
+            Reset();
+        }
+
+        bool FrameBufferObjectShared::ReadCurrent()
+        {
+            bool haveFBO = OPENCSG_HAS_EXT(ARB_framebuffer_object) != 0 || GLAD_GL_VERSION_3_0 != 0;
+            if (!haveFBO)
+                return false;
+
+            glGetIntegerv(GL_FRAMEBUFFER_BINDING, &oldFramebufferID);
+            if (oldFramebufferID == 0)
+                return false; // the attachments of the default framebuffer cannot be shared
+
+            // a multisampled depth buffer does not fit the ID texture
+            GLint samples = 0;
+            glGetIntegerv(GL_SAMPLES, &samples);
+            if (samples > 0)
+                return false;
+
+            GLint depthType = GL_NONE;
+            GLint stencilType = GL_NONE;
+            glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+            glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &stencilType);
+            if (depthType != stencilType || (depthType != GL_RENDERBUFFER && depthType != GL_TEXTURE))
+                return false;
+
+            GLint depthName = 0;
+            GLint stencilName = 0;
+            glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthName);
+            glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &stencilName);
+            if (depthName != stencilName || depthName == failedName)
+                return false;
+
+            GLint level = 0;
+            if (depthType == GL_TEXTURE) {
+                // only the level of a two-dimensional texture is attached again
+                GLint cubeMapFace = 0;
+                GLint layer = 0;
+                GLint layered = GL_FALSE;
+                glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL, &level);
+                glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_CUBE_MAP_FACE, &cubeMapFace);
+                glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LAYER, &layer);
+                if (GLAD_GL_VERSION_3_2)
+                    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_LAYERED, &layered);
+                if (cubeMapFace != 0 || layer != 0 || layered != GL_FALSE)
+                    return false;
+            }
+
+            sharedType = depthType;
+            sharedName = depthName;
+            sharedLevel = level;
+
+            return true;
+        }
+
+        bool FrameBufferObjectShared::Initialize(Dimensions dims)
+        {
+            if (sharedName == 0)
+                return false; // ReadCurrent() has failed
+
+            dimensions = dims;
+
+            glGenFramebuffers(1, &framebufferID);
+            glGenTextures(1, &textureID);
+
+            glBindFramebuffer(GL_FRAMEBUFFER, framebufferID);
+
+            glBindTexture(GL_TEXTURE_2D, textureID);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, GetWidth(), GetHeight(), 0, GL_RGBA, GL_INT, 0);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureID, 0);
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            Attach();
+
+            // e.g., a texture that is not two-dimensional, or a depth format
+            // that cannot be combined with the ID texture
+            GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+            glBindFramebuffer(GL_FRAMEBUFFER, oldFramebufferID);
+            if (status != GL_FRAMEBUFFER_COMPLETE) {
+                failedName = sharedName;
+                Reset();
+                return false;
+            }
+
+            initialized = true;
+
+            return true;
+        }
+
+        // Attaches the depth / stencil attachment of the application. Our
+        // FBO must be bound.
+        void FrameBufferObjectShared::Attach()
+        {
+            if (sharedType == GL_RENDERBUFFER) {
+                glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, sharedName);
+                glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, sharedName);
+            } else {
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, sharedName, sharedLevel);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, sharedName, sharedLevel);
+            }
+
+            attachedType = sharedType;
+            attachedName = sharedName;
+            attachedLevel = sharedLevel;
+        }
+
+        // Releases frame buffer objects
+        bool FrameBufferObjectShared::Reset()
+        {
+            if (textureID) {
+                glDeleteTextures(1, &textureID);
+                textureID = 0;
+            }
+            if (framebufferID) {
+                glDeleteFramebuffers(1, &framebufferID);
+                framebufferID = 0;
+            }
+
+            attachedType = GL_NONE;
+            attachedName = 0;
+            attachedLevel = 0;
+
+            dimensions = Dimensions();
+
+            initialized = false;
+
+            return true;
+        }
+
+        // If new requested size differs, regenerate FBO texture objects
+        bool FrameBufferObjectShared::Resize(Dimensions dims)
+        {
+            if (dimensions == dims) {
+                return true;
+            }
+
+            Reset();
+            return Initialize(dims);
+        }
+
+        // Binds the frame buffer object, after attaching the depth / stencil
+        // buffer of the application again if it has changed since.
+        bool FrameBufferObjectShared::BeginCapture()
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebufferID);
+            if (   attachedType != sharedType
+                || attachedName != sharedName
+                || attachedLevel != sharedLevel)
+                Attach();
+            return true;
+        }
+
+        // Unbinds frame buffer texture.
+        bool FrameBufferObjectShared::EndCapture()
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, oldFramebufferID);
+            return true;
+        }
+
+        // Sets the frame buffer texture as active texture object.
+        void FrameBufferObjectShared::Bind() const
+        {
+            glBindTexture(GL_TEXTURE_2D, textureID);
+        }
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
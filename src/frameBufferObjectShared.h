@@ -0,0 +1,117 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// frameBufferObjectShared.h
+//
+// frame buffer object class implementing the offscreen buffer interface,
+// which renders into the depth / stencil attachment of the frame buffer
+// object bound by the application
+//
+
+#ifndef __OpenCSG__frame_buffer_object_shared_h__
+#define __OpenCSG__frame_buffer_object_shared_h__
+
+#include "opencsgConfig.h"
+#include "offscreenBuffer.h"
+#include "openglExt.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        class FrameBufferObjectShared : public OffscreenBuffer {
+        public:
+            /// ctor / dtor
+            FrameBufferObjectShared();
+            virtual ~FrameBufferObjectShared();
+
+            /// Reads the currently bound FBO and its depth / stencil attachment.
+            /// Fails for the default framebuffer, for multisampled FBOs, and if
+            /// the depth and the stencil attachment are not the same object.
+            virtual bool ReadCurrent();
+
+            /// Initializes the frame buffer object with the intended width and height.
+            /// The frame buffer object is created with an RGBA texture, and the
+            /// depth / stencil attachment of the currently bound FBO.
+            virtual bool Initialize(Dimensions dims);
+
+            /// checks whether Initialize has been called before or not
+            virtual bool IsInitialized() const { return initialized; }
+
+            /// Change the size of the frame buffer object.
+            virtual bool Resize(Dimensions dims);
+
+            /// Begin drawing to the frame buffer object. (i.e. use as "output" texture)
+            virtual bool BeginCapture();
+            /// End drawing to the frame buffer object.
+            virtual bool EndCapture();
+
+            /// Bind the frame buffer object to the active texture unit for use as an "input" texture
+            virtual void Bind() const;
+
+            /// Enables the texture target appropriate for this frame buffer object.
+            virtual void EnableTextureTarget() const { if (initialized) glEnable(GL_TEXTURE_2D); }
+            /// Disables the texture target appropriate for this frame buffer object.
+            virtual void DisableTextureTarget() const { if (initialized) glDisable(GL_TEXTURE_2D); }
+
+            /// Returns the texture target this texture is bound to.
+            virtual unsigned int GetTextureTarget() const { return GL_TEXTURE_2D; }
+            /// Returns the width of the frame buffer object.
+            virtual int GetWidth() const  { return dimensions.width;  }
+            /// Returns the width of the frame buffer object.
+            virtual int GetHeight() const { return dimensions.height; }
+
+        private:
+            FrameBufferObjectShared(const FrameBufferObjectShared&);
+            FrameBufferObjectShared& operator=(const FrameBufferObjectShared&);
+
+            // Width and height of the frame buffer object
+            Dimensions   dimensions;
+
+            unsigned int textureID;
+
+            unsigned int framebufferID;
+            int          oldFramebufferID;
+
+            /// The depth / stencil attachment of the FBO of the application,
+            /// as read by ReadCurrent(), and as attached to our FBO
+            GLint        sharedType;
+            GLint        sharedName;
+            GLint        sharedLevel;
+            GLint        attachedType;
+            GLint        attachedName;
+            GLint        attachedLevel;
+
+            /// Attachment that could not be combined into a complete FBO
+            GLint        failedName;
+
+            bool         initialized;
+
+            /// Attaches the depth / stencil attachment read by ReadCurrent().
+            void Attach();
+
+            /// Removes the frame buffer object OpenGL resources.
+            bool Reset();
+        };
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__frame_buffer_object_shared_h__
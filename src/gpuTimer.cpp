@@ -0,0 +1,134 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// gpuTimer.cpp
+//
+
+#include "opencsgConfig.h"
+#include "gpuTimer.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        GPUTimer::GPUTimer() :
+            mNext(0),
+            mCurrent(0),
+            mHaveLastTimes(false)
+        {
+            for (int i = 0; i < StatisticsPhaseUnused; ++i) {
+                mLastTimes[i] = 0.0;
+            }
+        }
+
+        GPUTimer::~GPUTimer() {
+            for (std::size_t i = 0; i < RingSize; ++i) {
+                if (!mRing[i].queries.empty())
+                    glDeleteQueries(static_cast<GLsizei>(mRing[i].queries.size()), &mRing[i].queries[0]);
+            }
+        }
+
+        void GPUTimer::begin(Statistics* stats) {
+            // entries complete in the order they have been issued,
+            // so stop at the first one that is not available yet
+            for (std::size_t i = 0; i < RingSize; ++i) {
+                Entry& entry = mRing[(mNext + i) % RingSize];
+                if (!entry.pending)
+                    continue;
+                GLuint available = 0;
+                glGetQueryObjectuiv(entry.queries[entry.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available)
+                    break;
+                collect(entry, stats);
+            }
+
+            mCurrent = 0;
+            Entry& entry = mRing[mNext];
+            if (entry.pending)
+                return;
+
+            mCurrent = &entry;
+            mCurrent->used = 0;
+            mCurrent->phases.clear();
+            mNext = (mNext + 1) % RingSize;
+            mark(StatisticsPhaseUnused);
+        }
+
+        void GPUTimer::mark(int phase) {
+            if (!mCurrent)
+                return;
+            if (!mCurrent->phases.empty() && mCurrent->phases.back() == phase)
+                return;
+
+            if (mCurrent->used == mCurrent->queries.size()) {
+                GLuint query;
+                glGenQueries(1, &query);
+                mCurrent->queries.push_back(query);
+            }
+            glQueryCounter(mCurrent->queries[mCurrent->used], GL_TIMESTAMP);
+            mCurrent->phases.push_back(phase);
+            ++mCurrent->used;
+        }
+
+        void GPUTimer::end() {
+            if (!mCurrent)
+                return;
+
+            mark(StatisticsPhaseUnused);
+            mCurrent->pending = true;
+            mCurrent = 0;
+        }
+
+        void GPUTimer::collect(Entry& entry, Statistics* stats) {
+            for (int i = 0; i < StatisticsPhaseUnused; ++i) {
+                mLastTimes[i] = 0.0;
+            }
+
+            GLuint64 last = 0;
+            for (std::size_t i = 0; i < entry.used; ++i) {
+                GLuint64 timestamp = 0;
+                glGetQueryObjectui64v(entry.queries[i], GL_QUERY_RESULT, &timestamp);
+                if (i > 0 && entry.phases[i - 1] != StatisticsPhaseUnused) {
+                    mLastTimes[entry.phases[i - 1]] += static_cast<double>(timestamp - last) / 1.0e6;
+                }
+                last = timestamp;
+            }
+
+            for (int i = 0; i < StatisticsPhaseUnused; ++i) {
+                stats->gpuTime[i] += mLastTimes[i];
+            }
+            ++stats->gpuTimedRenders;
+
+            mHaveLastTimes = true;
+            entry.pending = false;
+        }
+
+        bool GPUTimer::getLastTimes(double milliseconds[StatisticsPhaseUnused]) const {
+            if (!mHaveLastTimes)
+                return false;
+
+            for (int i = 0; i < StatisticsPhaseUnused; ++i) {
+                milliseconds[i] = mLastTimes[i];
+            }
+            return true;
+        }
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
@@ -0,0 +1,94 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// gpuTimer.h
+//
+// measures the GPU time of the phases of the CSG algorithms with
+// timestamp queries, which are read back asynchronously
+//
+
+#ifndef __OpenCSG__gpu_timer_h__
+#define __OpenCSG__gpu_timer_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglExt.h"
+#include <vector>
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        /// Places timestamp queries at the phase changes during render().
+        /// The queries of a call of render() are kept in a ring of
+        /// RingSize entries and are only read back once they are available,
+        /// typically one or two frames later, so the CPU never waits for
+        /// the GPU. If all entries are still pending, render() is not timed.
+        class GPUTimer {
+        public:
+            enum { RingSize = 4 };
+
+            GPUTimer();
+            /// deletes the query objects. The context must be current.
+            ~GPUTimer();
+
+            /// reads back the results of earlier calls of render() that are
+            /// available and adds them to stats. Then starts timing the
+            /// current call of render(), if a ring entry is free.
+            void begin(Statistics* stats);
+            /// marks the beginning of phase. StatisticsPhaseUnused marks
+            /// time that is not attributed to any phase.
+            void mark(int phase);
+            /// ends timing the current call of render()
+            void end();
+
+            /// returns the phase times, in milliseconds, of the most recent
+            /// call of render() that has been read back. Returns false if
+            /// there is none.
+            bool getLastTimes(double milliseconds[StatisticsPhaseUnused]) const;
+
+        private:
+            GPUTimer(const GPUTimer&);
+            GPUTimer& operator=(const GPUTimer&);
+
+            struct Entry {
+                Entry() : used(0), pending(false) {}
+                std::vector<GLuint> queries;
+                std::vector<int> phases;
+                std::size_t used;
+                bool pending;
+            };
+
+            /// reads back the results of entry, which must be available
+            void collect(Entry& entry, Statistics* stats);
+
+            Entry mRing[RingSize];
+            /// the oldest entry, which is used next
+            std::size_t mNext;
+            /// the entry used by the current call of render(), or 0
+            Entry* mCurrent;
+            double mLastTimes[StatisticsPhaseUnused];
+            bool mHaveLastTimes;
+        };
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__gpu_timer_h__
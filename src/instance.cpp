@@ -0,0 +1,131 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// instance.cpp
+//
+
+#include "opencsgConfig.h"
+#include "instance.h"
+#include <typeinfo>
+
+namespace OpenCSG {
+
+    Instance::Instance(InstanceList* list, unsigned int instance) :
+        Primitive(list->primitive->getOperation(), list->primitive->getConvexity()),
+        mList(list),
+        mInstance(instance)
+    {
+    }
+
+    InstanceList* Instance::getInstanceList() const {
+        return mList;
+    }
+
+    InstancedPrimitive* Instance::getInstancedPrimitive() const {
+        return mList->primitive;
+    }
+
+    unsigned int Instance::getInstance() const {
+        return mInstance;
+    }
+
+    void Instance::render() {
+        mList->primitive->renderInstance(mInstance);
+    }
+
+    InstanceList::InstanceList(InstancedPrimitive* p) :
+        primitive(p),
+        hasObjectBoundingBox(false),
+        hullPoints(0),
+        hullCount(0)
+    {
+        const unsigned int count = primitive->getInstanceCount();
+        instances.reserve(count);
+        for (unsigned int i = 0; i < count; ++i) {
+            instances.emplace_back(this, i);
+        }
+    }
+
+    void InstanceList::update() {
+        float* box = objectBoundingBox;
+        hasObjectBoundingBox = primitive->getObjectBoundingBox(box[0], box[1], box[2], box[3], box[4], box[5], objectTransform);
+        hullPoints = primitive->getHullPoints(hullCount, hullTransform);
+
+        // the operation and convexity may have changed since the last
+        // render(). The bounding box is only projected from object
+        // coordinates if these are given.
+        const Operation operation = primitive->getOperation();
+        const unsigned int convexity = primitive->getConvexity();
+        const bool projected = hasObjectBoundingBox || hullPoints;
+        for (std::vector<Instance>::iterator itr = instances.begin(); itr != instances.end(); ++itr) {
+            itr->setOperation(operation);
+            itr->setConvexity(convexity);
+            if (!projected) {
+                float minx, miny, minz, maxx, maxy, maxz;
+                primitive->getInstanceBoundingBox(itr->getInstance(), minx, miny, minz, maxx, maxy, maxz);
+                itr->setBoundingBox(minx, miny, minz, maxx, maxy, maxz);
+            }
+        }
+    }
+
+    const Instance* asInstance(const Primitive* primitive) {
+        // cheaper than a dynamic_cast, since Instance has no subclasses
+        return typeid(*primitive) == typeid(Instance) ? static_cast<const Instance*>(primitive) : 0;
+    }
+
+    InstanceExpansion::InstanceExpansion(const std::vector<Primitive*>& primitives) :
+        mOriginal(primitives),
+        mExpand(false)
+    {
+        std::vector<Primitive*>::const_iterator itr = primitives.begin();
+        for (; itr != primitives.end(); ++itr) {
+            if (dynamic_cast<InstancedPrimitive*>(*itr)) {
+                break;
+            }
+        }
+        if (itr == primitives.end()) {
+            return;
+        }
+
+        mExpand = true;
+        mExpanded.reserve(primitives.size());
+        for (itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            InstancedPrimitive* primitive = dynamic_cast<InstancedPrimitive*>(*itr);
+            if (!primitive) {
+                mExpanded.push_back(*itr);
+                continue;
+            }
+
+            if (!primitive->mInstances) {
+                primitive->mInstances = new InstanceList(primitive);
+            }
+            InstanceList* list = primitive->mInstances;
+            list->update();
+            for (std::vector<Instance>::iterator instance = list->instances.begin(); instance != list->instances.end(); ++instance) {
+                mExpanded.push_back(&*instance);
+            }
+        }
+    }
+
+    const std::vector<Primitive*>& InstanceExpansion::getPrimitives() const {
+        return mExpand ? mExpanded : mOriginal;
+    }
+
+} // namespace OpenCSG
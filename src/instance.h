@@ -0,0 +1,105 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// instance.h
+//
+// instances of InstancedPrimitives as seen by the CSG algorithms
+//
+
+#ifndef __OpenCSG__instance_h__
+#define __OpenCSG__instance_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include <vector>
+
+namespace OpenCSG {
+
+    class InstanceList;
+
+    /// a single instance of an InstancedPrimitive. Instances are handled
+    /// as ordinary primitives by the CSG algorithms, with the operation and
+    /// convexity of the InstancedPrimitive and the bounding box of the instance.
+    class Instance : public Primitive {
+    public:
+        Instance(InstanceList* list, unsigned int instance);
+
+        /// the list of instances this instance belongs to
+        InstanceList* getInstanceList() const;
+        /// the InstancedPrimitive this instance belongs to
+        InstancedPrimitive* getInstancedPrimitive() const;
+        /// the index of the instance in the InstancedPrimitive
+        unsigned int getInstance() const;
+
+        /// draws the instance
+        virtual void render();
+
+    private:
+        InstanceList* mList;
+        unsigned int mInstance;
+    };
+
+    /// the instances of an InstancedPrimitive, which owns them until its
+    /// instances change. The bounding box in object coordinates and the
+    /// hull points of the InstancedPrimitive are fetched once per render()
+    /// for all instances.
+    class InstanceList {
+    public:
+        InstanceList(InstancedPrimitive* primitive);
+
+        /// updates the instances from the InstancedPrimitive at the
+        /// beginning of render()
+        void update();
+
+        InstancedPrimitive* primitive;
+        std::vector<Instance> instances;
+
+        bool hasObjectBoundingBox;
+        float objectBoundingBox[6];
+        float objectTransform[16];
+
+        const float* hullPoints;
+        unsigned int hullCount;
+        float hullTransform[16];
+    };
+
+    /// returns the instance if primitive is one, else 0
+    const Instance* asInstance(const Primitive* primitive);
+
+    /// replaces each InstancedPrimitive in an array of primitives by its
+    /// instances. The instances live as long as their InstancedPrimitive
+    /// does not change.
+    class InstanceExpansion {
+    public:
+        InstanceExpansion(const std::vector<Primitive*>& primitives);
+
+        /// the expanded primitives. This is the original array if
+        /// it does not contain InstancedPrimitives.
+        const std::vector<Primitive*>& getPrimitives() const;
+
+    private:
+        const std::vector<Primitive*>& mOriginal;
+        bool mExpand;
+        std::vector<Primitive*> mExpanded;
+    };
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__instance_h__
@@ -0,0 +1,135 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// instancedPrimitive.cpp
+//
+// implements InstancedPrimitive (declared in opencsg.h)
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "context.h"
+#include "instance.h"
+#include "openglExt.h"
+#include "openglHelper.h"
+#include <cassert>
+
+namespace OpenCSG {
+
+    InstancedPrimitive::InstancedPrimitive(Operation o, unsigned int c,
+                                           unsigned int vertexArray, unsigned int firstIndex,
+                                           unsigned int count, int baseVertex) :
+        BufferPrimitive(o, c, vertexArray, firstIndex, count, baseVertex),
+        mInstances(0) {
+    }
+
+    InstancedPrimitive::InstancedPrimitive(const InstancedPrimitive& other) :
+        BufferPrimitive(other),
+        mTransforms(other.mTransforms),
+        mBoundingBoxes(other.mBoundingBoxes),
+        mInstances(0) {
+    }
+
+    InstancedPrimitive& InstancedPrimitive::operator=(const InstancedPrimitive& other) {
+        if (this != &other) {
+            BufferPrimitive::operator=(other);
+            mTransforms = other.mTransforms;
+            mBoundingBoxes = other.mBoundingBoxes;
+            delete mInstances;
+            mInstances = 0;
+        }
+        return *this;
+    }
+
+    InstancedPrimitive::~InstancedPrimitive() {
+        delete mInstances;
+    }
+
+    void InstancedPrimitive::addInstance(const float transform[16],
+                                         float minx, float miny, float minz,
+                                         float maxx, float maxy, float maxz) {
+        assert(minx <= maxx);
+        assert(miny <= maxy);
+        assert(minz <= maxz);
+        mTransforms.insert(mTransforms.end(), transform, transform + 16);
+        mBoundingBoxes.push_back(minx);
+        mBoundingBoxes.push_back(miny);
+        mBoundingBoxes.push_back(minz);
+        mBoundingBoxes.push_back(maxx);
+        mBoundingBoxes.push_back(maxy);
+        mBoundingBoxes.push_back(maxz);
+        delete mInstances;
+        mInstances = 0;
+    }
+
+    void InstancedPrimitive::clearInstances() {
+        mTransforms.clear();
+        mBoundingBoxes.clear();
+        delete mInstances;
+        mInstances = 0;
+    }
+
+    unsigned int InstancedPrimitive::getInstanceCount() const {
+        return static_cast<unsigned int>(mBoundingBoxes.size() / 6);
+    }
+
+    const float* InstancedPrimitive::getInstanceTransform(unsigned int instance) const {
+        assert(instance < getInstanceCount());
+        return &mTransforms[16 * instance];
+    }
+
+    void InstancedPrimitive::getInstanceBoundingBox(unsigned int instance,
+                                                    float& minx, float& miny, float& minz,
+                                                    float& maxx, float& maxy, float& maxz) const {
+        assert(instance < getInstanceCount());
+        const float* box = &mBoundingBoxes[6 * instance];
+        minx = box[0];
+        miny = box[1];
+        minz = box[2];
+        maxx = box[3];
+        maxy = box[4];
+        maxz = box[5];
+    }
+
+    void InstancedPrimitive::renderInstance(unsigned int instance) {
+        const float* transform = getInstanceTransform(instance);
+
+        if (OpenGL::isCoreProfile()) {
+            OpenGL::setInstanceMatrix(transform);
+            BufferPrimitive::render();
+            OpenGL::setInstanceMatrix(0);
+            return;
+        }
+
+        glMatrixMode(GL_MODELVIEW);
+        glPushMatrix();
+        glMultMatrixf(transform);
+        BufferPrimitive::render();
+        glPopMatrix();
+    }
+
+    void InstancedPrimitive::render() {
+        const unsigned int count = getInstanceCount();
+        for (unsigned int i = 0; i < count; ++i) {
+            renderInstance(i);
+        }
+    }
+
+} // namespace OpenCSG
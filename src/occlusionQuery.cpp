@@ -67,6 +67,44 @@ namespace OpenCSG {
 
 
 
+        class OcclusionQueryCore : public OcclusionQuery {
+        public:
+            OcclusionQueryCore(GLenum queryType);
+            virtual ~OcclusionQueryCore();
+
+            virtual void beginQuery();
+            virtual void endQuery();
+            virtual unsigned int getQueryResult();
+
+        private:
+            GLenum mQueryType;
+            GLuint mQueryObject;
+        };
+
+        OcclusionQueryCore::OcclusionQueryCore(GLenum queryType) : mQueryType(queryType) {
+            glGenQueries(1, &mQueryObject);
+        }
+
+        OcclusionQueryCore::~OcclusionQueryCore() {
+            glDeleteQueries(1, &mQueryObject);
+        }
+
+        void OcclusionQueryCore::beginQuery() {
+            glBeginQuery(mQueryType, mQueryObject);
+        }
+
+        void OcclusionQueryCore::endQuery() {
+            glEndQuery(mQueryType);
+        }
+
+        unsigned int OcclusionQueryCore::getQueryResult() {
+            GLuint fragmentCount;
+            glGetQueryObjectuiv(mQueryObject, GL_QUERY_RESULT, &fragmentCount);
+            return fragmentCount;
+        }
+
+
+
         class OcclusionQueryNV : public OcclusionQuery {
         public:
             OcclusionQueryNV();
@@ -106,6 +144,12 @@ namespace OpenCSG {
 
         OcclusionQuery* getOcclusionQuery(bool exactNumberNeeded) {
 
+            // Core profile contexts do not necessarily report the ARB extension,
+            // and the ARB entry points are then not available
+            if (GLAD_GL_VERSION_3_3) {
+                return new OcclusionQueryCore(exactNumberNeeded ? GL_SAMPLES_PASSED : GL_ANY_SAMPLES_PASSED);
+            }
+
             if (!exactNumberNeeded && OPENCSG_HAS_EXT(ARB_occlusion_query2)) {
                 OcclusionQueryARB* occlusionQuery = new OcclusionQueryARB;
                 occlusionQuery->mQueryType = GL_ANY_SAMPLES_PASSED;
@@ -125,6 +169,12 @@ namespace OpenCSG {
             return 0;
         }
 
+        bool haveHardwareOcclusionQueries() {
+            return OPENCSG_HAS_EXT(ARB_occlusion_query)
+                || OPENCSG_HAS_EXT(NV_occlusion_query)
+                || GLAD_GL_VERSION_3_3;
+        }
+
     } // namespace OpenGL
 
 } // namespace OpenCSG
@@ -60,6 +60,10 @@ namespace OpenCSG {
         /// it must be deleted!
         OcclusionQuery* getOcclusionQuery(bool exactNumberNeeded);
 
+        /// checks whether getOcclusionQuery() returns an occlusion query
+        /// object
+        bool haveHardwareOcclusionQueries();
+
     } // namespace OpenGL
 
 } // namespace OpenCSG
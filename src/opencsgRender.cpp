@@ -22,47 +22,165 @@
 
 #include "opencsgConfig.h"
 #include <opencsg.h>
+#include "autoTuner.h"
+#include "capture.h"
 #include "context.h"
+#include "costModel.h"
+#include "instance.h"
+#include "occlusionQuery.h"
 #include "opencsgRender.h"
+#include "openglHelper.h"
 #include "primitiveHelper.h"
+#include "progressive.h"
+#include "projection.h"
+#include "refinement.h"
 #include "settings.h"
+#include "statistics.h"
+#include "trace.h"
+#include <algorithm>
 
 namespace OpenCSG {
 
     namespace {
 
-        bool haveHardwareOcclusionQueries() {
-            return OPENCSG_HAS_EXT(ARB_occlusion_query)
-                || OPENCSG_HAS_EXT(NV_occlusion_query);
+        // renders the primitives into the current tile, or into the whole
+        // canvas if it is not tiled
+        void renderAlgorithm(const std::vector<Primitive*>& primitives,
+                             Algorithm algorithm,
+                             DepthComplexityAlgorithm depthComplexityAlgorithm)
+        {
+            switch (algorithm) {
+            case Goldfeather:
+                if (!Progressive::current) {
+                    renderGoldfeather(primitives, depthComplexityAlgorithm);
+                    break;
+                }
+                // the layers are merged into a private depth buffer, which
+                // is kept between the calls
+                Progressive::beginAccumulation();
+                if (!Progressive::current->converged)
+                    renderGoldfeather(primitives, depthComplexityAlgorithm);
+                Progressive::endAccumulation();
+                break;
+
+            case SCS:
+                renderSCS(primitives, depthComplexityAlgorithm);
+                break;
+
+            default:
+                break;
+            }
         }
 
-        Algorithm chooseAlgorithm(const std::vector<Primitive*>& primitives) {
-            if (Algo::getConvexity(primitives) >= 2) {
-                return Goldfeather;
+        // renders the tile of width x height pixels at x, y in the canvas
+        // given by viewport. The tile only gets the primitives whose
+        // bounding boxes overlap it, and it is skipped if it is outside the
+        // bounding box of an intersected primitive, since the CSG product
+        // cannot be visible there.
+        void renderTile(const std::vector<Primitive*>& primitives,
+                        std::vector<Primitive*>& tilePrimitives,
+                        Algorithm algorithm,
+                        DepthComplexityAlgorithm depthComplexityAlgorithm,
+                        const GLint viewport[4],
+                        int x, int y, int width, int height)
+        {
+            // the tile in normalized device coordinates, enlarged by
+            // a pixel to be on the safe side with rounding
+            const float minx = 2.0f * static_cast<float>(x - 1) / static_cast<float>(viewport[2]) - 1.0f;
+            const float miny = 2.0f * static_cast<float>(y - 1) / static_cast<float>(viewport[3]) - 1.0f;
+            const float maxx = 2.0f * static_cast<float>(x + width + 1) / static_cast<float>(viewport[2]) - 1.0f;
+            const float maxy = 2.0f * static_cast<float>(y + height + 1) / static_cast<float>(viewport[3]) - 1.0f;
+
+            tilePrimitives.clear();
+            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+                float tminx, tminy, tminz, tmaxx, tmaxy, tmaxz;
+                (*itr)->getBoundingBox(tminx, tminy, tminz, tmaxx, tmaxy, tmaxz);
+                if (tminx <= maxx && tmaxx >= minx && tminy <= maxy && tmaxy >= miny) {
+                    tilePrimitives.push_back(*itr);
+                } else if ((*itr)->getOperation() == Intersection) {
+                    OPENCSG_STATISTICS(++stats->skippedTiles);
+                    return;
+                }
             }
-            return SCS;
+
+            OPENCSG_STATISTICS(++stats->tiles);
+            OPENCSG_TRACE_SCOPE("OpenCSG.tile", -1);
+
+            OpenGL::tilePos[0] = viewport[0] + x;
+            OpenGL::tilePos[1] = viewport[1] + y;
+            OpenGL::tilePos[2] = width;
+            OpenGL::tilePos[3] = height;
+            renderAlgorithm(tilePrimitives, algorithm, depthComplexityAlgorithm);
         }
 
-        DepthComplexityAlgorithm chooseDepthComplexityAlgorithm(const std::vector<Primitive*>& primitives) {
-            if (!haveHardwareOcclusionQueries() && primitives.size() > 40) {
-                return DepthComplexitySampling;
+        void resetTile()
+        {
+            OpenGL::tilePos[0] = 0;
+            OpenGL::tilePos[1] = 0;
+            OpenGL::tilePos[2] = 0;
+            OpenGL::tilePos[3] = 0;
+        }
+
+        // renders a canvas larger than maxTileSize() tile by tile
+        void renderTiled(const std::vector<Primitive*>& primitives,
+                         Algorithm algorithm,
+                         DepthComplexityAlgorithm depthComplexityAlgorithm,
+                         const GLint viewport[4],
+                         int tileSize)
+        {
+            std::vector<Primitive*> tilePrimitives;
+            tilePrimitives.reserve(primitives.size());
+
+            for (int y = 0; y < viewport[3]; y += tileSize) {
+                for (int x = 0; x < viewport[2]; x += tileSize) {
+                    const int width = (std::min)(tileSize, viewport[2] - x);
+                    const int height = (std::min)(tileSize, viewport[3] - y);
+                    renderTile(primitives, tilePrimitives, algorithm, depthComplexityAlgorithm, viewport, x, y, width, height);
+                }
             }
 
-            if (haveHardwareOcclusionQueries() && primitives.size() > 20) {
-                return OcclusionQuery;
+            resetTile();
+        }
+
+        // renders the canvas at the reduced resolution set by
+        // Refinement::begin(), and then the areas around the edges, where
+        // pixels have been left out, at full resolution as tiles
+        void renderRefined(const std::vector<Primitive*>& primitives,
+                           Algorithm algorithm,
+                           DepthComplexityAlgorithm depthComplexityAlgorithm,
+                           const GLint viewport[4])
+        {
+            renderAlgorithm(primitives, algorithm, depthComplexityAlgorithm);
+
+            const std::vector<PCArea> areas = Refinement::end();
+            if (areas.empty())
+                return;
+
+            OPENCSG_TRACE_SCOPE("OpenCSG.refine", -1);
+
+            std::vector<Primitive*> tilePrimitives;
+            tilePrimitives.reserve(primitives.size());
+
+            Refinement::refining = true;
+            for (std::vector<PCArea>::const_iterator itr = areas.begin(); itr != areas.end(); ++itr) {
+                renderTile(primitives, tilePrimitives, algorithm, depthComplexityAlgorithm, viewport,
+                           itr->minx, itr->miny, itr->maxx - itr->minx, itr->maxy - itr->miny);
             }
+            Refinement::refining = false;
 
-            return NoDepthComplexitySampling;
+            resetTile();
         }
 
     } // unnamed namespace
 
-
     static void renderDispatch(const std::vector<Primitive*>& primitives,
                                Algorithm algorithm,
                                DepthComplexityAlgorithm depthComplexityAlgorithm)
     {
+        OPENCSG_TRACE_SCOPE("OpenCSG.renderDispatch", -1);
+
         if (primitives.empty()) {
+            Progressive::finish();
             return;
         }
 
@@ -75,33 +193,84 @@ namespace OpenCSG {
             }
         }
         if (!hasIntersected) {
+            Progressive::finish();
             return;
         }
 
+        // the bounding boxes are projected once per call, for the cost
+        // model, the tiles and the algorithms alike
+        OpenGL::fetchMatrices();
+        Algo::projectBoundingBoxes(primitives);
+
+        // the algorithms query the CameraOutsideOptimization themselves, so
+        // the setting chosen automatically is set for this call and this
+        // thread only
+        const ThreadOption cameraOutside = getThreadOption(CameraOutsideOptimization);
+        if (getOption(CameraOutsideOptimization) == OptimizationAutomatic) {
+            setThreadOption(CameraOutsideOptimization,
+                            Algo::mayBeClippedByNearPlane(primitives) ? OptimizationOff : OptimizationOn);
+        }
+
+        CostEstimate estimate;
+        OpenGL::AutoTuner* tuner = 0;
         if (algorithm == Automatic) {
-            algorithm = chooseAlgorithm(primitives);
-            depthComplexityAlgorithm = chooseDepthComplexityAlgorithm(primitives);
+            OPENCSG_TRACE_SCOPE("OpenCSG.estimateCosts", -1);
+            Algo::estimateCosts(primitives, estimate);
+            // the auto-tuner cannot time renderProgressive(), which is split over frames
+            if (getOption(AutoTuneSetting) != 0 && GLAD_GL_VERSION_3_3 && !Progressive::current) {
+                tuner = OpenGL::getAutoTuner();
+                OpenGL::AutoTuner::Candidate candidate = tuner->choose(estimate);
+                algorithm = candidate.algorithm;
+                depthComplexityAlgorithm = candidate.depthComplexityAlgorithm;
+                setThreadOption(CameraOutsideOptimization, candidate.cameraOutside);
+            } else {
+                Algo::chooseCheapest(estimate, algorithm, depthComplexityAlgorithm);
+            }
         }
 
-        if (depthComplexityAlgorithm == OcclusionQuery && !haveHardwareOcclusionQueries()) {
+        if (depthComplexityAlgorithm == OcclusionQuery && !OpenGL::haveHardwareOcclusionQueries()) {
             // hardware support is missing. issue a warning?
             depthComplexityAlgorithm = DepthComplexitySampling;
         }
 
-        if (algorithm != Automatic) {
-            switch (algorithm) {
-            case Goldfeather:
-                renderGoldfeather(primitives, depthComplexityAlgorithm);
-                break;
+        OPENCSG_STATISTICS(stats->algorithm = algorithm; stats->depthComplexityAlgorithm = depthComplexityAlgorithm);
+        OPENCSG_STATISTICS(stats->cameraOutsideOptimization = static_cast<Optimization>(getOption(CameraOutsideOptimization)));
+        // the costs are only estimated for choosing the algorithm, not for
+        // the statistics, which would distort the time they measure
+        OPENCSG_STATISTICS(stats->estimatedTime += (std::max)(0.0, estimate.milliseconds[algorithm][depthComplexityAlgorithm]));
 
-            case SCS:
-                renderSCS(primitives, depthComplexityAlgorithm);
-                break;
+        if (Progressive::current)
+            Progressive::restartIfChanged(primitives, algorithm, depthComplexityAlgorithm);
 
-            default:
-                break;
+        if (tuner)
+            tuner->begin();
+
+        if (algorithm != Automatic) {
+            // renderProgressive() keeps its results in a buffer of the
+            // full canvas size and is never tiled. Neither is the depth
+            // buffer of the application shared by the SCS algorithm. Both
+            // are computed at full resolution.
+            GLint viewport[4];
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            const bool untiled = Progressive::current
+                              || (algorithm == SCS && OpenGL::getSharedDepthStencilBuffer());
+            const int tileSize = untiled ? 0 : OpenGL::maxTileSize();
+            if (tileSize > 0 && (viewport[2] > tileSize || viewport[3] > tileSize)) {
+                renderTiled(primitives, algorithm, depthComplexityAlgorithm, viewport, tileSize);
+            }
+            else {
+                const int divisor = untiled ? 1 : Refinement::chooseDivisor(primitives);
+                if (divisor > 1 && Refinement::begin(divisor))
+                    renderRefined(primitives, algorithm, depthComplexityAlgorithm, viewport);
+                else
+                    renderAlgorithm(primitives, algorithm, depthComplexityAlgorithm);
             }
         }
+
+        if (tuner)
+            tuner->end();
+
+        restoreThreadOption(CameraOutsideOptimization, cameraOutside);
     }
 
     void render(const std::vector<Primitive*>& primitives)
@@ -111,7 +280,80 @@ namespace OpenCSG {
         Algorithm algorithm = (Algorithm)getOption(AlgorithmSetting);
         DepthComplexityAlgorithm depthComplexityAlgorithm = (DepthComplexityAlgorithm)getOption(DepthComplexitySetting);
 
-        renderDispatch(primitives, algorithm, depthComplexityAlgorithm);
+        Stats::begin();
+        Trace::begin();
+
+        {
+            OPENCSG_TRACE_SCOPE("OpenCSG.render", -1);
+            InstanceExpansion expansion(primitives);
+            if (Capture::pending)
+                Capture::write(expansion.getPrimitives());
+            OPENCSG_STATISTICS(stats->primitives += static_cast<unsigned int>(expansion.getPrimitives().size()));
+            renderDispatch(expansion.getPrimitives(), algorithm, depthComplexityAlgorithm);
+        }
+
+        // the offscreen buffers may have been evicted meanwhile
+        OpenGL::releaseEvictedOffscreenBuffers();
+
+        Trace::end();
+        Stats::end();
+    }
+
+    bool renderProgressive(const std::vector<Primitive*>& primitives, double milliseconds)
+    {
+        OpenGL::ensureFunctionPointers();
+
+        // fence sync objects time the steps
+        if (!GLAD_GL_VERSION_3_2) {
+            render(primitives);
+            return true;
+        }
+
+        Algorithm algorithm = (Algorithm)getOption(AlgorithmSetting);
+        DepthComplexityAlgorithm depthComplexityAlgorithm = (DepthComplexityAlgorithm)getOption(DepthComplexitySetting);
+
+        Progressive::current = OpenGL::getProgressiveCache()->get(primitives);
+        Progressive::begin(milliseconds);
+        Stats::begin();
+        Trace::begin();
+
+        {
+            OPENCSG_TRACE_SCOPE("OpenCSG.renderProgressive", -1);
+            InstanceExpansion expansion(primitives);
+            if (Capture::pending)
+                Capture::write(expansion.getPrimitives());
+            OPENCSG_STATISTICS(stats->primitives += static_cast<unsigned int>(expansion.getPrimitives().size()));
+            renderDispatch(expansion.getPrimitives(), algorithm, depthComplexityAlgorithm);
+        }
+
+        // the buffers kept for the next call count for the memory budget
+        OpenGL::useOffscreenBuffer();
+        const bool converged = Progressive::current->converged;
+        Progressive::current = 0;
+
+        // the offscreen buffers may have been evicted meanwhile, and the
+        // progress with them
+        OpenGL::releaseEvictedOffscreenBuffers();
+
+        Trace::end();
+        Stats::end();
+        Progressive::end();
+
+        return converged;
+    }
+
+    void warmUp()
+    {
+        OpenGL::ensureFunctionPointers();
+        OpenGL::coreProfile = OpenGL::isCoreProfile();
+
+        const bool rectangular = OpenGL::getCapabilities().rectangularOffscreenBuffers;
+
+        OpenGL::warmUpPrograms();
+        warmUpGoldfeather(rectangular);
+        warmUpSCS(rectangular);
+        if (getOption(ResolutionSetting) != FullResolution)
+            Refinement::warmUp();
     }
 
 } // namespace OpenCSG
@@ -37,6 +37,16 @@ namespace OpenCSG {
     /// Goldfeather algorithm. Implemented in renderGoldfeather.cpp
     void renderGoldfeather(const std::vector<Primitive*>& primitives, DepthComplexityAlgorithm);
 
+    /// Starts building the merge programs of the SCS algorithm for the
+    /// current vertex shader, for rectangular textures as well if
+    /// rectangular is true. Implemented in renderSCS.cpp
+    void warmUpSCS(bool rectangular);
+
+    /// Starts building the merge programs of the Goldfeather algorithm for
+    /// the current vertex shader, for rectangular textures as well if
+    /// rectangular is true. Implemented in renderGoldfeather.cpp
+    void warmUpGoldfeather(bool rectangular);
+
 } // namespace OpenCSG
 
 #endif // __OpenCSG__opencsg_render_h__
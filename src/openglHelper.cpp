@@ -23,36 +23,307 @@
 #include "opencsgConfig.h"
 #include "openglExt.h"
 #include "openglHelper.h"
+#include "context.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace OpenCSG {
 
     namespace OpenGL {
 
-        GLfloat projection[16];
-        GLfloat modelview[16];
-        GLint canvasPos[4];
+        thread_local GLfloat projection[16];
+        thread_local GLfloat modelview[16];
+        thread_local GLint canvasPos[4];
+
+        thread_local GLint stencilBits = 0;
+        thread_local unsigned int stencilMax = 0;
+        thread_local unsigned int stencilMask = 0;
+
+        thread_local GLint scissorPos[4];
+
+        thread_local int resolutionDivisor = 1;
+
+        thread_local GLint tilePos[4] = { 0, 0, 0, 0 };
+        thread_local bool inTile = false;
+
+        thread_local bool coreProfile = false;
+
+        namespace {
+
+            thread_local GLuint currentProgram = 0;
+            thread_local GLint colorLocation = -1;
+            thread_local GLint idBaseLocation = -1;
+            thread_local GLint idPerDrawLocation = -1;
+            thread_local GLfloat currentColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+            // Also passes the ID of the primitive to the fragment shader, as
+            // color: idBase, plus the index of the draw in a multi-draw call
+            // and of the instance in an instanced draw call if idPerDraw is
+            // set. The ID is not used by the programs of resetProgram().
+            const char defaultCoreVertexShader[] =
+                "#version 330 core\n"
+                "#extension GL_ARB_shader_draw_parameters : enable\n"
+                "layout(std140) uniform OpenCSGMatrices {\n"
+                "    mat4 modelViewMatrix;\n"
+                "    mat4 projectionMatrix;\n"
+                "};\n"
+                "layout(location = 0) in vec4 position;\n"
+                "layout(location = 12) in mat4 instanceMatrix;\n"
+                "uniform uint idBase;\n"
+                "uniform bool idPerDraw;\n"
+                "flat out vec4 idColor;\n"
+                "void main() {\n"
+                "    gl_Position = projectionMatrix * modelViewMatrix * instanceMatrix * position;\n"
+                "    uint id = idBase;\n"
+                "    if (idPerDraw) {\n"
+                "#ifdef GL_ARB_shader_draw_parameters\n"
+                "        id += uint(gl_DrawIDARB);\n"
+                "#endif\n"
+                "        id += uint(gl_InstanceID);\n"
+                "    }\n"
+                "    idColor = vec4((uvec4(id) >> uvec4(24u, 16u, 8u, 0u)) & 0xffu) / 255.0;\n"
+                "}\n";
+
+            const char coreQuadVertexShader[] =
+                "#version 330 core\n"
+                "layout(location = 0) in vec2 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n";
+
+            // drawQuads() loads identity matrices in compatibility contexts
+            const char compatQuadVertexShader[] =
+                "#version 110\n"
+                "void main() {\n"
+                "    gl_Position = gl_Vertex;\n"
+                "}\n";
+
+            // ftransform() is invariant to the fixed function pipeline, as
+            // the merge requires
+            const char defaultMergeVertexShader[] =
+                "#version 110\n"
+                "void main() {\n"
+                "    gl_Position = ftransform();\n"
+                "}\n";
+
+            const char colorFragmentShader[] =
+                "#version 330 core\n"
+                "uniform vec4 color;\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = color;\n"
+                "}\n";
 
-        GLint stencilBits = 0;
-        unsigned int stencilMax = 0;
-        unsigned int stencilMask = 0;
+            // outputs the ID computed by defaultCoreVertexShader
+            const char idFragmentShader[] =
+                "#version 330 core\n"
+                "flat in vec4 idColor;\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = idColor;\n"
+                "}\n";
 
-        GLint scissorPos[4];
+            // Program IDs of GLSL programs are derived from the vertex shader
+            // pointer. The merge programs use offsets 0 to 3 and 6 to 7, see
+            // renderGoldfeather.cpp and renderSCS.cpp.
+            const int ColorIdOffset = 4;
+            const int IdIdOffset = 5;
+
+        } // unnamed namespace
 
         void scissor(const PCArea& area) {
-            const int dx = area.maxx - area.minx;
-            const int dy = area.maxy - area.miny;
-            glScissor(area.minx, area.miny, dx, dy);
+            if (resolutionDivisor > 1) {
+                // map the area conservatively into the reduced viewport
+                GLint viewport[4];
+                reducedViewport(resolutionDivisor, viewport);
+                const double sx = static_cast<double>(viewport[2]) / static_cast<double>((std::max)(canvasPos[2], 1));
+                const double sy = static_cast<double>(viewport[3]) / static_cast<double>((std::max)(canvasPos[3], 1));
+                const int minx = viewport[0] + static_cast<int>(std::floor((area.minx - canvasPos[0]) * sx));
+                const int miny = viewport[1] + static_cast<int>(std::floor((area.miny - canvasPos[1]) * sy));
+                const int maxx = viewport[0] + static_cast<int>(std::ceil((area.maxx - canvasPos[0]) * sx));
+                const int maxy = viewport[1] + static_cast<int>(std::ceil((area.maxy - canvasPos[1]) * sy));
+                glScissor(minx, miny, maxx - minx, maxy - miny);
+                glEnable(GL_SCISSOR_TEST);
+                return;
+            }
+
+            const PCArea tiled = tileArea(area);
+            const int dx = tiled.maxx - tiled.minx;
+            const int dy = tiled.maxy - tiled.miny;
+            glScissor(tiled.minx, tiled.miny, dx, dy);
             glEnable(GL_SCISSOR_TEST);
         }
 
-        void drawQuad() {
-            glMatrixMode(GL_PROJECTION);
-            glPushMatrix();
-            glLoadIdentity();
-            glMatrixMode(GL_MODELVIEW);
-            glPushMatrix();
-            glLoadIdentity();
+        PCArea tileArea(const PCArea& area) {
+            if (tilePos[2] == 0)
+                return area;
+
+            PCArea result((std::max)(area.minx, tilePos[0]),
+                          (std::max)(area.miny, tilePos[1]),
+                          (std::min)(area.maxx, tilePos[0] + tilePos[2]),
+                          (std::min)(area.maxy, tilePos[1] + tilePos[3]));
+            result.maxx = (std::max)(result.minx, result.maxx);
+            result.maxy = (std::max)(result.miny, result.maxy);
+
+            if (inTile) {
+                result.minx -= tilePos[0];
+                result.miny -= tilePos[1];
+                result.maxx -= tilePos[0];
+                result.maxy -= tilePos[1];
+            }
+
+            return result;
+        }
+
+        int maxTileSize() {
+            const Capabilities& caps = getCapabilities();
+            int size = caps.maxTextureSize;
+            if (caps.maxRenderbufferSize > 0)
+                size = (std::min)(size, static_cast<int>(caps.maxRenderbufferSize));
+
+            const int setting = getOption(TileSizeSetting);
+            if (setting > 0)
+                size = (std::min)(size, setting);
+
+            // a square offscreen buffer must fit into the memory budget
+            const std::size_t budget = getOffscreenMemoryBudget();
+            if (budget > 0) {
+                const double side = std::sqrt(static_cast<double>(budget / offscreenBytesPerPixel));
+                if (side < static_cast<double>(size))
+                    size = static_cast<int>(side);
+            }
+
+            return (std::max)(size, 1);
+        }
+
+        void reducedViewport(int divisor, GLint viewport[4]) {
+            viewport[0] = canvasPos[0] / divisor;
+            viewport[1] = canvasPos[1] / divisor;
+            viewport[2] = (canvasPos[2] + divisor - 1) / divisor;
+            viewport[3] = (canvasPos[3] + divisor - 1) / divisor;
+        }
+
+        void color4ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a) {
+            if (!coreProfile) {
+                glColor4ub(r, g, b, a);
+                return;
+            }
+
+            currentColor[0] = static_cast<float>(static_cast<double>(r) / 255.0);
+            currentColor[1] = static_cast<float>(static_cast<double>(g) / 255.0);
+            currentColor[2] = static_cast<float>(static_cast<double>(b) / 255.0);
+            currentColor[3] = static_cast<float>(static_cast<double>(a) / 255.0);
+            glUniform4fv(colorLocation, 1, currentColor);
+        }
+
+        void color4ubv(const GLubyte* v) {
+            color4ub(v[0], v[1], v[2], v[3]);
+        }
+
+        const char* coreVertexShader() {
+            const char* vertexShader = getVertexShader();
+            return vertexShader ? vertexShader : defaultCoreVertexShader;
+        }
+
+        const char* mergeVertexShader() {
+            if (coreProfile)
+                return coreVertexShader();
+            const char* vertexShader = getVertexShader();
+            return vertexShader ? vertexShader : defaultMergeVertexShader;
+        }
+
+        const char* quadVertexShader() {
+            return coreProfile ? coreQuadVertexShader : compatQuadVertexShader;
+        }
+
+        void useProgram(GLuint program) {
+            glUseProgram(program);
+            currentProgram = program;
+            colorLocation = -1;
+            idBaseLocation = -1;
+            idPerDrawLocation = -1;
+            if (coreProfile && program) {
+                const ProgramUniforms& uniforms = getGLSLProgramUniforms(program);
+                colorLocation = uniforms.color;
+                idBaseLocation = uniforms.idBase;
+                idPerDrawLocation = uniforms.idPerDraw;
+            }
+        }
+
+        void resetProgram() {
+            if (!coreProfile) {
+                useProgram(0);
+                return;
+            }
+
+            const char* vertexShader = coreVertexShader();
+            useProgram(getGLSLProgram(vertexShader + ColorIdOffset, vertexShader, colorFragmentShader));
+        }
+
+        bool hasIDProgram() {
+            return coreProfile && !getVertexShader();
+        }
+
+        void useIDProgram() {
+            useProgram(getGLSLProgram(defaultCoreVertexShader + IdIdOffset, defaultCoreVertexShader, idFragmentShader));
+        }
+
+        void setID(GLuint id, bool perDraw) {
+            glUniform1ui(idBaseLocation, id);
+            glUniform1i(idPerDrawLocation, perDraw ? 1 : 0);
+        }
+
+        void warmUpPrograms() {
+            if (!coreProfile)
+                return;
+
+            const char* vertexShader = coreVertexShader();
+            getGLSLProgram(vertexShader + ColorIdOffset, vertexShader, colorFragmentShader, false);
+            if (hasIDProgram())
+                getGLSLProgram(defaultCoreVertexShader + IdIdOffset, defaultCoreVertexShader, idFragmentShader, false);
+            getGLSLProgram(coreQuadVertexShader, coreQuadVertexShader, colorFragmentShader, false);
+        }
+
+        void uploadMatrices() {
+            GLfloat matrices[32];
+            std::copy(modelview, modelview + 16, matrices);
+            std::copy(projection, projection + 16, matrices + 16);
+
+            GLuint buffer = getMatrixUniformBuffer();
+            glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+            glBufferData(GL_UNIFORM_BUFFER, sizeof(matrices), matrices, GL_STREAM_DRAW);
+            glBindBufferBase(GL_UNIFORM_BUFFER, matrixUniformBufferBinding, buffer);
+        }
+
+        void setInstanceMatrix(const GLfloat* transform) {
+            static const GLfloat identity[16] = {
+                1.0f, 0.0f, 0.0f, 0.0f,
+                0.0f, 1.0f, 0.0f, 0.0f,
+                0.0f, 0.0f, 1.0f, 0.0f,
+                0.0f, 0.0f, 0.0f, 1.0f
+            };
+            if (!transform) {
+                transform = identity;
+            }
+            for (GLuint column = 0; column < 4; ++column) {
+                glVertexAttrib4fv(instanceMatrixLocation + column, transform + 4 * column);
+            }
+        }
+
+        void fetchMatrices() {
+            if (isCoreProfile()) {
+                getMatrices(modelview, projection);
+            } else {
+                glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+                glGetFloatv(GL_PROJECTION_MATRIX, projection);
+            }
+            glGetIntegerv(GL_VIEWPORT, canvasPos);
+        }
 
+        void drawQuad(GLuint program) {
             const GLfloat v[8] = {
                   -1.0f, -1.0f,
                    1.0f, -1.0f,
@@ -60,22 +331,92 @@ namespace OpenCSG {
                    1.0f,  1.0f
             };
 
+            drawQuads(v, 1, program);
+        }
+
+        void drawQuads(const GLfloat* v, int count, GLuint program) {
+            GLuint oldProgram = currentProgram;
+            if (program)
+                useProgram(program);
+
+            if (coreProfile) {
+                GLint oldVertexArray = 0;
+                GLint oldArrayBuffer = 0;
+                glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVertexArray);
+                glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldArrayBuffer);
+
+                if (!program) {
+                    useProgram(getGLSLProgram(coreQuadVertexShader, coreQuadVertexShader, colorFragmentShader));
+                    glUniform4fv(colorLocation, 1, currentColor);
+                }
+
+                glBindVertexArray(getCoreVertexArray());
+                glBindBuffer(GL_ARRAY_BUFFER, getCoreVertexBuffer());
+                glBufferData(GL_ARRAY_BUFFER, count * 8 * sizeof(GLfloat), v, GL_STREAM_DRAW);
+
+                std::vector<GLint> first(count);
+                std::vector<GLsizei> vertices(count, 4);
+                for (int i = 0; i < count; ++i) {
+                    first[i] = 4 * i;
+                }
+                glMultiDrawArrays(GL_TRIANGLE_STRIP, &first[0], &vertices[0], count);
+
+                glBindVertexArray(oldVertexArray);
+                glBindBuffer(GL_ARRAY_BUFFER, oldArrayBuffer);
+                useProgram(oldProgram);
+                return;
+            }
+
+            glMatrixMode(GL_PROJECTION);
+            glPushMatrix();
+            glLoadIdentity();
+            glMatrixMode(GL_MODELVIEW);
+            glPushMatrix();
+            glLoadIdentity();
+
+            // client-side vertex arrays require that neither a vertex array object
+            // nor an array buffer, possibly left bound by the primitives, is active
+            GLint oldVertexArray = 0;
+            GLint oldArrayBuffer = 0;
+            if (GLAD_GL_VERSION_3_0) {
+                glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVertexArray);
+                if (oldVertexArray) {
+                    glBindVertexArray(0);
+                }
+            }
+            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldArrayBuffer);
+            if (oldArrayBuffer) {
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+
             GLboolean origVertexArrayState = glIsEnabled(GL_VERTEX_ARRAY);
             if (!origVertexArrayState) {
                 glEnableClientState(GL_VERTEX_ARRAY);
             }
 
-            glVertexPointer(2, GL_FLOAT, 0, v);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            for (int i = 0; i < count; ++i) {
+                glVertexPointer(2, GL_FLOAT, 0, v + 8 * i);
+                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            }
 
             if (!origVertexArrayState) {
                 glDisableClientState(GL_VERTEX_ARRAY);
             }
 
+            if (oldArrayBuffer) {
+                glBindBuffer(GL_ARRAY_BUFFER, oldArrayBuffer);
+            }
+            if (oldVertexArray) {
+                glBindVertexArray(oldVertexArray);
+            }
+
             glMatrixMode(GL_PROJECTION);
             glPopMatrix();
             glMatrixMode(GL_MODELVIEW);
             glPopMatrix();
+
+            if (program)
+                useProgram(oldProgram);
         }
 
     } // namespace OpenGL
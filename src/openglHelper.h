@@ -33,28 +33,139 @@ namespace OpenCSG {
 
     namespace OpenGL {
 
+        // The state of the CSG computation below is kept per thread, such
+        // that threads can render with their own OpenGL contexts at the
+        // same time.
+
         // copy of the projection matrix during CSG computation
-        extern GLfloat projection[16];
+        extern thread_local GLfloat projection[16];
         // copy of the modelview matrix during CSG computation
-        extern GLfloat modelview[16];
+        extern thread_local GLfloat modelview[16];
         // copy of the viewport size during CSG computation
-        extern GLint canvasPos[4];
+        extern thread_local GLint canvasPos[4];
 
-        // number of stencil bits in the offscreen buffer
-        extern GLint stencilBits;
+        // number of stencil bits in the offscreen buffer, copied from
+        // the capabilities of the context by the ChannelManager
+        extern thread_local GLint stencilBits;
         // the number where the stencil value would "wrap around" to zero
-        extern unsigned int stencilMax;
+        extern thread_local unsigned int stencilMax;
         // stencilMax - 1
-        extern unsigned int stencilMask;
+        extern thread_local unsigned int stencilMask;
 
         // copy of the scissor settings for CSG computation
-        extern GLint scissorPos[4];
+        extern thread_local GLint scissorPos[4];
+
+        // 2 or 4 while rendering into the offscreen buffer at half or quarter
+        // resolution (see ResolutionSetting), else 1
+        extern thread_local int resolutionDivisor;
+
+        // the tile of the canvas (in window coordinates) being computed if
+        // the canvas is larger than the offscreen buffer may be (see
+        // TileSizeSetting). Its width is 0 if the canvas is not tiled
+        extern thread_local GLint tilePos[4];
+
+        // whether the offscreen buffer is being rendered into while tiling,
+        // i.e., pixel coordinates are relative to the origin of the tile
+        extern thread_local bool inTile;
+
+        // whether the CSG computation takes place in a core profile context
+        extern thread_local bool coreProfile;
+
+        // binding point of the uniform block OpenCSGMatrices
+        const GLuint matrixUniformBufferBinding = 0;
 
-        // enables scissoring into area (given in pixel coordinates)
+        // first of the four generic vertex attributes holding the
+        // transformation of an InstancedPrimitive (core profile only)
+        const GLuint instanceMatrixLocation = 12;
+
+        // copies the current modelview and projection matrices (those set
+        // with setMatrices() in a core profile context) and the viewport
+        // into the variables above
+        void fetchMatrices();
+
+        // enables scissoring into area (given in pixel coordinates). At
+        // reduced resolution, the area is scaled to the reduced viewport.
+        // While tiling, the area is mapped by tileArea().
         void scissor(const PCArea& area);
 
+        // clips area (given in pixel coordinates) to the current tile and,
+        // while rendering into the offscreen buffer, moves it relative to
+        // the origin of the tile. Returns area if the canvas is not tiled
+        PCArea tileArea(const PCArea& area);
+
+        // the maximum width and height of the offscreen buffer: the
+        // TileSizeSetting, bounded by the maximum texture and renderbuffer
+        // sizes and by the memory budget. Larger canvases are rendered in
+        // tiles of this size
+        int maxTileSize();
+
+        // computes the viewport for rendering into the offscreen buffer at
+        // the reduced resolution given by divisor: the canvas with all
+        // coordinates divided by divisor, rounding the size up
+        void reducedViewport(int divisor, GLint viewport[4]);
+
+        // sets the color for rendering into the offscreen buffer. In a
+        // core profile context, this sets the uniform of the current program
+        void color4ub(GLubyte r, GLubyte g, GLubyte b, GLubyte a);
+        void color4ubv(const GLubyte* v);
+
+        // the vertex shader for rendering in a core profile context:
+        // the one set by the user, or a default one
+        const char* coreVertexShader();
+
+        // the vertex shader of the GLSL programs merging the CSG product
+        // into the canvas: coreVertexShader() in a core profile context,
+        // else the one set by the user, or a default one using ftransform()
+        const char* mergeVertexShader();
+
+        // the vertex shader for GLSL programs passed to drawQuads()
+        const char* quadVertexShader();
+
+        // activates the GLSL program and remembers it as current program
+        void useProgram(GLuint program);
+
+        // activates the program for rendering primitives into the offscreen
+        // buffer: the fixed function pipeline in a compatibility context, or
+        // a GLSL program that outputs the current color in a core profile context
+        void resetProgram();
+
+        // whether the primitives can be rendered with IDs computed by the
+        // vertex shader, see useIDProgram(). This requires a core profile
+        // context and the default vertex shader, since a vertex shader set
+        // by the user does not pass the ID to the fragment shader
+        bool hasIDProgram();
+
+        // activates the program for rendering primitives into the offscreen
+        // buffer with their ID as color, which is set with setID()
+        // instead of color4ub(). Requires hasIDProgram()
+        void useIDProgram();
+
+        // sets the ID of the primitives rendered next with the program of
+        // useIDProgram() or of a merge program using the same vertex shader.
+        // If perDraw is set, the ID is increased by one for each draw of a
+        // multi-draw call and for each instance of an instanced draw call
+        void setID(GLuint id, bool perDraw);
+
+        // starts building the GLSL programs used by resetProgram() and
+        // drawQuads() for the current vertex shader (core profile only)
+        void warmUpPrograms();
+
+        // copies the matrices into the uniform buffer for OpenCSGMatrices
+        // (core profile only)
+        void uploadMatrices();
+
+        // sets the current values of the instance matrix attributes to
+        // transform, or to the identity if transform is 0 (core profile only)
+        void setInstanceMatrix(const GLfloat* transform);
+
         // renders a full screen quad
-        void drawQuad();
+        void drawQuad(GLuint program = 0);
+
+        // renders count quads, given as triangle strips of four 2d vertices
+        // each in normalized device coordinates. If program is given, which
+        // must use quadVertexShader(), it is used for the quads instead of
+        // the current program resp. the current color
+        void drawQuads(const GLfloat* v, int count, GLuint program = 0);
 
     } // namespace OpenGL
 
@@ -24,9 +24,58 @@
 
 #include "opencsgConfig.h"
 #include <opencsg.h>
+#include "instance.h"
+#include "projection.h"
+#include <algorithm>
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace OpenCSG {
+
+    namespace {
+
+        // The bounding box in object coordinates and the hull points are
+        // kept in a table beside the primitives, such that the layout of
+        // Primitive, from which applications derive, stays unchanged.
+        struct ObjectSpaceData {
+            std::vector<float> objectBoundingBox;
+            std::vector<float> hullPoints;
+        };
+
+        typedef std::unordered_map<const Primitive*, ObjectSpaceData> ObjectSpaceTable;
+
+        // The table and its mutex are never destroyed, since primitives
+        // with static storage duration may be destroyed after them. The
+        // mutex is only locked once per render() by getObjectSpace().
+        ObjectSpaceTable& objectSpaceTable() {
+            static ObjectSpaceTable* table = new ObjectSpaceTable;
+            return *table;
+        }
+
+        std::mutex& objectSpaceMutex() {
+            static std::mutex* mutex = new std::mutex;
+            return *mutex;
+        }
+
+        // returns 0 if nothing is stored for the primitive
+        const ObjectSpaceData* findObjectSpaceData(const Primitive* primitive) {
+            const ObjectSpaceTable& table = objectSpaceTable();
+            if (table.empty()) {
+                return 0;
+            }
+            ObjectSpaceTable::const_iterator itr = table.find(primitive);
+            return itr == table.end() ? 0 : &itr->second;
+        }
+
+        void eraseIfEmpty(const Primitive* primitive, const ObjectSpaceData& data) {
+            if (data.objectBoundingBox.empty() && data.hullPoints.empty()) {
+                objectSpaceTable().erase(primitive);
+            }
+        }
+
+    } // unnamed namespace
     
     Primitive::Primitive(Operation o, unsigned int c) :
         mOperation(o),
@@ -39,7 +88,12 @@ namespace OpenCSG {
         mMaxz(1.0f) {
     }
 
-    Primitive::~Primitive() { }
+    Primitive::~Primitive() {
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        if (!objectSpaceTable().empty()) {
+            objectSpaceTable().erase(this);
+        }
+    }
 
     void Primitive::setOperation(Operation o) {
         mOperation = o;
@@ -81,4 +135,161 @@ namespace OpenCSG {
         maxz = mMaxz;
     }
 
+    void Primitive::setObjectBoundingBox(float minx, float miny, float minz,
+                                         float maxx, float maxy, float maxz,
+                                         const float* transform) {
+        assert(minx <= maxx);
+        assert(miny <= maxy);
+        assert(minz <= maxz);
+        const float box[6] = { minx, miny, minz, maxx, maxy, maxz };
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        std::vector<float>& objectBoundingBox = objectSpaceTable()[this].objectBoundingBox;
+        objectBoundingBox.assign(box, box + 6);
+        if (transform) {
+            objectBoundingBox.insert(objectBoundingBox.end(), transform, transform + 16);
+        }
+    }
+
+    void Primitive::clearObjectBoundingBox() {
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        ObjectSpaceTable::iterator itr = objectSpaceTable().find(this);
+        if (itr != objectSpaceTable().end()) {
+            itr->second.objectBoundingBox.clear();
+            eraseIfEmpty(this, itr->second);
+        }
+    }
+
+    bool Primitive::getObjectBoundingBox(float& minx, float& miny, float& minz,
+                                         float& maxx, float& maxy, float& maxz,
+                                         float transform[16]) const {
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        const ObjectSpaceData* data = findObjectSpaceData(this);
+        if (!data || data->objectBoundingBox.empty()) {
+            return false;
+        }
+
+        const std::vector<float>& objectBoundingBox = data->objectBoundingBox;
+        minx = objectBoundingBox[0];
+        miny = objectBoundingBox[1];
+        minz = objectBoundingBox[2];
+        maxx = objectBoundingBox[3];
+        maxy = objectBoundingBox[4];
+        maxz = objectBoundingBox[5];
+        for (int i = 0; i < 16; ++i) {
+            transform[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        }
+        if (objectBoundingBox.size() == 22) {
+            std::copy(objectBoundingBox.begin() + 6, objectBoundingBox.end(), transform);
+        }
+        return true;
+    }
+
+    void Primitive::setHullPoints(const float* points, unsigned int count,
+                                  const float* transform) {
+        if (count == 0) {
+            clearHullPoints();
+            return;
+        }
+
+        // the transformation is stored first, followed by the points
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        std::vector<float>& hullPoints = objectSpaceTable()[this].hullPoints;
+        hullPoints.resize(16);
+        for (int i = 0; i < 16; ++i) {
+            hullPoints[i] = transform ? transform[i] : ((i % 5 == 0) ? 1.0f : 0.0f);
+        }
+        hullPoints.insert(hullPoints.end(), points, points + 3 * count);
+    }
+
+    void Primitive::clearHullPoints() {
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        ObjectSpaceTable::iterator itr = objectSpaceTable().find(this);
+        if (itr != objectSpaceTable().end()) {
+            itr->second.hullPoints.clear();
+            eraseIfEmpty(this, itr->second);
+        }
+    }
+
+    const float* Primitive::getHullPoints(unsigned int& count, float transform[16]) const {
+        std::lock_guard<std::mutex> lock(objectSpaceMutex());
+        const ObjectSpaceData* data = findObjectSpaceData(this);
+        if (!data || data->hullPoints.empty()) {
+            count = 0;
+            return 0;
+        }
+
+        const std::vector<float>& hullPoints = data->hullPoints;
+        std::copy(hullPoints.begin(), hullPoints.begin() + 16, transform);
+        count = static_cast<unsigned int>((hullPoints.size() - 16) / 3);
+        return &hullPoints[16];
+    }
+
+    namespace Algo {
+
+        bool getObjectSpace(const std::vector<Primitive*>& primitives, std::vector<ObjectSpace>& objectSpace) {
+            std::lock_guard<std::mutex> lock(objectSpaceMutex());
+
+            const bool tableEmpty = objectSpaceTable().empty();
+            if (tableEmpty) {
+                bool instanceData = false;
+                for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end() && !instanceData; ++itr) {
+                    const Instance* instance = asInstance(*itr);
+                    instanceData = instance && (instance->getInstanceList()->hasObjectBoundingBox || instance->getInstanceList()->hullPoints);
+                }
+                if (!instanceData) {
+                    return false;
+                }
+            }
+
+            objectSpace.resize(primitives.size());
+            for (std::size_t i = 0; i < primitives.size(); ++i) {
+                ObjectSpace& result = objectSpace[i];
+                result.hasBoundingBox = false;
+                result.hullPoints = 0;
+                result.hullCount = 0;
+
+                // the data of the InstancedPrimitive, fetched by the
+                // InstanceExpansion, with the transformation of the instance
+                if (const Instance* instance = asInstance(primitives[i])) {
+                    const InstanceList* list = instance->getInstanceList();
+                    const float* transform = list->primitive->getInstanceTransform(instance->getInstance());
+                    if (list->hasObjectBoundingBox) {
+                        result.hasBoundingBox = true;
+                        std::copy(list->objectBoundingBox, list->objectBoundingBox + 6, result.boundingBox);
+                        multMatrix(transform, list->objectTransform, result.boundingBoxTransform);
+                    }
+                    if (list->hullPoints) {
+                        result.hullPoints = list->hullPoints;
+                        result.hullCount = list->hullCount;
+                        multMatrix(transform, list->hullTransform, result.hullTransform);
+                    }
+                    continue;
+                }
+
+                const ObjectSpaceData* data = tableEmpty ? 0 : findObjectSpaceData(primitives[i]);
+                if (!data) {
+                    continue;
+                }
+                if (!data->objectBoundingBox.empty()) {
+                    result.hasBoundingBox = true;
+                    std::copy(data->objectBoundingBox.begin(), data->objectBoundingBox.begin() + 6, result.boundingBox);
+                    for (int k = 0; k < 16; ++k) {
+                        result.boundingBoxTransform[k] = (k % 5 == 0) ? 1.0f : 0.0f;
+                    }
+                    if (data->objectBoundingBox.size() == 22) {
+                        std::copy(data->objectBoundingBox.begin() + 6, data->objectBoundingBox.end(), result.boundingBoxTransform);
+                    }
+                }
+                if (!data->hullPoints.empty()) {
+                    std::copy(data->hullPoints.begin(), data->hullPoints.begin() + 16, result.hullTransform);
+                    result.hullCount = static_cast<unsigned int>((data->hullPoints.size() - 16) / 3);
+                    result.hullPoints = &data->hullPoints[16];
+                }
+            }
+
+            return true;
+        }
+
+    } // namespace Algo
+
 } // namespace OpenCSG
@@ -22,9 +22,13 @@
 
 #include "opencsgConfig.h"
 #include <opencsg.h>
+#include "context.h"
+#include "instance.h"
 #include "openglExt.h"
 #include "openglHelper.h"
 #include "primitiveHelper.h"
+#include "statistics.h"
+#include "trace.h"
 #include <algorithm>
 
 namespace OpenCSG {
@@ -79,6 +83,9 @@ namespace OpenCSG {
         unsigned int calcMaxDepthComplexity(const std::vector<Primitive*>& primitives,
                                             const PCArea& area) {
 
+            OPENCSG_TRACE_SCOPE("DepthComplexity.sample", -1);
+            OPENCSG_STATISTICS_PHASE(DepthComplexityPhase);
+
             glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 
             glDisable(GL_DEPTH_TEST);
@@ -89,22 +96,23 @@ namespace OpenCSG {
 
             glEnable(GL_CULL_FACE);
 
-            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
-                glCullFace((*itr)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
-                (*itr)->render();
-            }
+            renderBatchCulled(primitives);
 
             glDisable(GL_CULL_FACE);
             glDisable(GL_STENCIL_TEST);
             glEnable(GL_DEPTH_TEST);
 
-            int dx = area.maxx - area.minx;
-            int dy = area.maxy - area.miny;
+            const PCArea tiled = tileArea(area);
+            int dx = tiled.maxx - tiled.minx;
+            int dy = tiled.maxy - tiled.miny;
 
             std::size_t size = static_cast<std::size_t>(dx) * dy;
+            if (size == 0)
+                return 0;
             GLubyte * buf = new GLubyte[size];
 
-            glPixelStorei(GL_PACK_SWAP_BYTES, GL_FALSE);
+            if (!coreProfile)
+                glPixelStorei(GL_PACK_SWAP_BYTES, GL_FALSE);
             glPixelStorei(GL_PACK_ALIGNMENT, 1);
             glPixelStorei(GL_PACK_ROW_LENGTH, 0);
             glPixelStorei(GL_PACK_SKIP_ROWS, 0);
@@ -112,7 +120,7 @@ namespace OpenCSG {
 
             // This is pathologically slow on ATI HD4670 if not the complete viewport is read back.
             // So better always read the complete viewport or make this configurable?
-            glReadPixels(area.minx, area.miny, dx, dy, GL_STENCIL_INDEX, GL_UNSIGNED_BYTE, buf);
+            glReadPixels(tiled.minx, tiled.miny, dx, dy, GL_STENCIL_INDEX, GL_UNSIGNED_BYTE, buf);
 
             unsigned char m = *std::max_element(buf, buf+size);
 
@@ -120,6 +128,8 @@ namespace OpenCSG {
 
             delete[] buf;
 
+            OPENCSG_STATISTICS(stats->depthComplexity = (std::max)(stats->depthComplexity, max));
+
             return max;
         }
 
@@ -129,12 +139,204 @@ namespace OpenCSG {
             glStencilMask(255);
             glEnable(GL_STENCIL_TEST);
   
+            // renderBatchCulled() reorders the primitives, but in the same
+            // way for every layer, so each fragment still ends up in
+            // exactly one layer
             glEnable(GL_CULL_FACE);
+            renderBatchCulled(primitives);
+            glDisable(GL_CULL_FACE);
+        }
+
+        namespace {
+
+            class MultiDraw {
+            public:
+                MultiDraw(bool ids) : mVertexArray(0), mIds(ids), mFirstId(0) {}
+
+                // returns false if the primitive cannot be drawn together
+                // with the primitives added before. With IDs, only
+                // consecutive IDs can be drawn together, and only if the
+                // vertex shader knows the index of each draw
+                bool add(const BufferPrimitive* primitive, GLuint id) {
+                    if (!mCounts.empty()) {
+                        if (primitive->getVertexArray() != mVertexArray)
+                            return false;
+                        if (mIds && (!getCapabilities().shaderDrawParameters || id != mFirstId + mCounts.size()))
+                            return false;
+                    } else {
+                        mFirstId = id;
+                    }
+                    mVertexArray = primitive->getVertexArray();
+                    mCounts.push_back(primitive->getCount());
+                    mIndices.push_back(reinterpret_cast<const void*>(primitive->getFirstIndex() * sizeof(GLuint)));
+                    mBaseVertices.push_back(primitive->getBaseVertex());
+                    return true;
+                }
+
+                void flush() {
+                    if (mCounts.empty())
+                        return;
+                    if (mIds)
+                        setID(mFirstId, true);
+                    glBindVertexArray(mVertexArray);
+                    glMultiDrawElementsBaseVertex(GL_TRIANGLES, &mCounts[0], GL_UNSIGNED_INT,
+                                                  &mIndices[0], static_cast<GLsizei>(mCounts.size()),
+                                                  &mBaseVertices[0]);
+                    mCounts.clear();
+                    mIndices.clear();
+                    mBaseVertices.clear();
+                }
+
+            private:
+                GLuint mVertexArray;
+                bool mIds;
+                GLuint mFirstId;
+                std::vector<GLsizei> mCounts;
+                std::vector<const void*> mIndices;
+                std::vector<GLint> mBaseVertices;
+            };
+
+            class InstancedDraw {
+            public:
+                InstancedDraw(bool ids) : mPrimitive(0), mIds(ids), mFirstId(0) {}
+
+                // returns false if the instance cannot be drawn together
+                // with the instances added before. With IDs, only
+                // consecutive IDs can be drawn together
+                bool add(const Instance* instance, GLuint id) {
+                    if (mPrimitive) {
+                        if (instance->getInstancedPrimitive() != mPrimitive)
+                            return false;
+                        if (mIds && id != mFirstId + mInstances.size())
+                            return false;
+                    } else {
+                        mFirstId = id;
+                    }
+                    mPrimitive = instance->getInstancedPrimitive();
+                    const GLfloat* transform = mPrimitive->getInstanceTransform(instance->getInstance());
+                    mTransforms.insert(mTransforms.end(), transform, transform + 16);
+                    mInstances.push_back(instance->getInstance());
+                    return true;
+                }
+
+                void flush() {
+                    if (!mPrimitive)
+                        return;
+                    if (mIds)
+                        setID(mFirstId, true);
+                    if (mInstances.size() == 1) {
+                        mPrimitive->renderInstance(mInstances[0]);
+                    } else {
+                        draw();
+                    }
+                    mPrimitive = 0;
+                    mTransforms.clear();
+                    mInstances.clear();
+                }
+
+            private:
+                void draw() {
+                    GLint oldArrayBuffer = 0;
+                    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldArrayBuffer);
+
+                    glBindVertexArray(mPrimitive->getVertexArray());
+                    glBindBuffer(GL_ARRAY_BUFFER, getInstanceBuffer());
+                    glBufferData(GL_ARRAY_BUFFER, mTransforms.size() * sizeof(GLfloat), &mTransforms[0], GL_STREAM_DRAW);
+                    for (GLuint column = 0; column < 4; ++column) {
+                        const GLuint location = instanceMatrixLocation + column;
+                        glEnableVertexAttribArray(location);
+                        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, 16 * sizeof(GLfloat),
+                                              reinterpret_cast<const void*>(4 * column * sizeof(GLfloat)));
+                        glVertexAttribDivisor(location, 1);
+                    }
+
+                    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, mPrimitive->getCount(), GL_UNSIGNED_INT,
+                                                      reinterpret_cast<const void*>(mPrimitive->getFirstIndex() * sizeof(GLuint)),
+                                                      static_cast<GLsizei>(mInstances.size()),
+                                                      mPrimitive->getBaseVertex());
+
+                    // leave the vertex array object of the application as it was
+                    for (GLuint column = 0; column < 4; ++column) {
+                        const GLuint location = instanceMatrixLocation + column;
+                        glVertexAttribDivisor(location, 0);
+                        glDisableVertexAttribArray(location);
+                    }
+                    glBindBuffer(GL_ARRAY_BUFFER, oldArrayBuffer);
+                    setInstanceMatrix(0);
+                }
+
+                InstancedPrimitive* mPrimitive;
+                bool mIds;
+                GLuint mFirstId;
+                std::vector<GLfloat> mTransforms;
+                std::vector<unsigned int> mInstances;
+            };
+
+        } // unnamed namespace
+
+        void renderBatch(const std::vector<Primitive*>& primitives, const unsigned int* ids) {
+            OPENCSG_STATISTICS(stats->renderCalls[Stats::phase] += static_cast<unsigned int>(primitives.size()));
+
+            if (!GLAD_GL_VERSION_3_2) {
+                for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
+                    (*j)->render();
+                }
+                return;
+            }
+
+            MultiDraw multiDraw(ids != 0);
+            InstancedDraw instancedDraw(ids != 0);
+            for (std::size_t k = 0; k < primitives.size(); ++k) {
+                Primitive* primitive = primitives[k];
+                const GLuint id = ids ? ids[k] : 0;
+                const Instance* instance = coreProfile ? asInstance(primitive) : 0;
+                if (instance) {
+                    multiDraw.flush();
+                    if (!instancedDraw.add(instance, id)) {
+                        instancedDraw.flush();
+                        instancedDraw.add(instance, id);
+                    }
+                    continue;
+                }
+                instancedDraw.flush();
+
+                const BufferPrimitive* bufferPrimitive = dynamic_cast<const BufferPrimitive*>(primitive);
+                if (bufferPrimitive) {
+                    if (!multiDraw.add(bufferPrimitive, id)) {
+                        multiDraw.flush();
+                        multiDraw.add(bufferPrimitive, id);
+                    }
+                } else {
+                    multiDraw.flush();
+                    // the application may draw the primitive with several
+                    // draw calls, which all get the same ID
+                    if (ids)
+                        setID(id, false);
+                    primitive->render();
+                }
+            }
+            multiDraw.flush();
+            instancedDraw.flush();
+        }
+
+        void renderBatchCulled(const std::vector<Primitive*>& primitives) {
+            std::vector<Primitive*> intersected;
+            std::vector<Primitive*> subtracted;
             for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
-                glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
-                (*j)->render();
+                if ((*j)->getOperation() == Intersection)
+                    intersected.push_back(*j);
+                else
+                    subtracted.push_back(*j);
+            }
+
+            if (!intersected.empty()) {
+                glCullFace(GL_BACK);
+                renderBatch(intersected);
+            }
+            if (!subtracted.empty()) {
+                glCullFace(GL_FRONT);
+                renderBatch(subtracted);
             }
-            glDisable(GL_CULL_FACE);
         }
 
     } // namespace OpenGL
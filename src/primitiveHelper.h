@@ -63,6 +63,25 @@ namespace OpenCSG {
         /// buffer afterwards.
         void renderLayer(unsigned int layer, const std::vector<Primitive*>& primitives);
 
+        /// renders all primitives with the current OpenGL state. Consecutive
+        /// BufferPrimitives that share a vertex array object are submitted
+        /// with a single multi-draw call, and in a core profile context,
+        /// consecutive instances of the same InstancedPrimitive with a single
+        /// instanced draw call. All other primitives are rendered with their
+        /// render() method.
+        /// If ids is given, the current program must compute the IDs in the
+        /// vertex shader (see OpenGL::useIDProgram()), and primitives[k] is
+        /// rendered with the ID ids[k]. Then primitives are only drawn
+        /// together if their IDs are consecutive, and multi-draw calls
+        /// require GL_ARB_shader_draw_parameters.
+        void renderBatch(const std::vector<Primitive*>& primitives, const unsigned int* ids = 0);
+
+        /// renders the intersected primitives with back faces culled and the
+        /// subtracted primitives with front faces culled, using renderBatch().
+        /// Since the primitives are reordered, this must only be used if the
+        /// result does not depend on the rendering order.
+        void renderBatchCulled(const std::vector<Primitive*>& primitives);
+
     } // namespace OpenGL
 
 } // namespace OpenCSG
@@ -0,0 +1,185 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// programBinaryCache.cpp
+//
+// A cached program is a file opencsg-<key>.bin in the cache directory,
+// with <key> the 64-bit FNV-1a hash of GL_VENDOR, GL_RENDERER, GL_VERSION
+// and the shader sources in hex. It holds the magic "OCPB", the binary
+// format as 32-bit integer and the binary as returned by
+// glGetProgramBinary().
+//
+
+#include "opencsgConfig.h"
+#include "programBinaryCache.h"
+#include <opencsg.h>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace OpenCSG {
+
+    static std::string gProgramBinaryCache;
+    static std::mutex gProgramBinaryCacheMutex;
+
+    /// redeclared from opencsg.h
+    void setProgramBinaryCache(const std::string& directory) {
+        std::lock_guard<std::mutex> lock(gProgramBinaryCacheMutex);
+        gProgramBinaryCache = directory;
+    }
+
+    /// redeclared from opencsg.h
+    std::string getProgramBinaryCache() {
+        std::lock_guard<std::mutex> lock(gProgramBinaryCacheMutex);
+        return gProgramBinaryCache;
+    }
+
+    namespace OpenGL {
+
+        namespace {
+
+            const char magic[4] = { 'O', 'C', 'P', 'B' };
+
+            void hashString(unsigned long long& hash, const char* s) {
+                // including the terminating zero, which separates the strings
+                do {
+                    hash ^= static_cast<unsigned char>(*s);
+                    hash *= 1099511628211ULL;
+                } while (*s++);
+            }
+
+            // returns the file of the program built from the given sources, or
+            // an empty string if the cache is disabled or not supported
+            std::string cacheFile(const char* vertexShader, const char* fragmentShader) {
+                const std::string directory = getProgramBinaryCache();
+                if (directory.empty() || !OPENCSG_HAS_EXT(ARB_get_program_binary))
+                    return std::string();
+
+                GLint formats = 0;
+                glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+                if (formats <= 0)
+                    return std::string();
+
+                // a binary is only valid for the driver that has created it
+                unsigned long long hash = 14695981039346656037ULL;
+                const GLenum driver[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+                for (int i = 0; i < 3; ++i) {
+                    const char* s = reinterpret_cast<const char*>(glGetString(driver[i]));
+                    hashString(hash, s ? s : "");
+                }
+                hashString(hash, vertexShader);
+                hashString(hash, fragmentShader);
+
+                char name[32];
+                std::snprintf(name, sizeof(name), "opencsg-%016llx.bin", hash);
+
+                std::string file = directory;
+                const char last = file[file.size() - 1];
+                if (last != '/' && last != '\\')
+                    file += '/';
+                return file + name;
+            }
+
+        } // unnamed namespace
+
+        bool loadProgramBinary(GLuint program, const char* vertexShader, const char* fragmentShader) {
+            const std::string filename = cacheFile(vertexShader, fragmentShader);
+            if (filename.empty())
+                return false;
+
+            std::vector<char> binary;
+            unsigned int format = 0;
+            if (std::FILE* file = std::fopen(filename.c_str(), "rb")) {
+                char header[4];
+                if (   std::fread(header, sizeof(header), 1, file) == 1
+                    && std::memcmp(header, magic, sizeof(magic)) == 0
+                    && std::fread(&format, sizeof(format), 1, file) == 1
+                ) {
+                    char buffer[4096];
+                    std::size_t n;
+                    while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+                        binary.insert(binary.end(), buffer, buffer + n);
+                }
+                std::fclose(file);
+            }
+
+            if (!binary.empty()) {
+                glProgramBinary(program, static_cast<GLenum>(format), &binary[0], static_cast<GLsizei>(binary.size()));
+                GLint success = GL_FALSE;
+                glGetProgramiv(program, GL_LINK_STATUS, &success);
+                if (success)
+                    return true;
+                // e.g., after a driver update that kept the version string
+            }
+
+            glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            return false;
+        }
+
+        void storeProgramBinary(GLuint program, const char* vertexShader, const char* fragmentShader) {
+            const std::string filename = cacheFile(vertexShader, fragmentShader);
+            if (filename.empty())
+                return;
+
+            GLint success = GL_FALSE;
+            GLint length = 0;
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+            glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+            if (!success || length <= 0)
+                return;
+
+            std::vector<char> binary(length);
+            GLenum binaryFormat = 0;
+            glGetProgramBinary(program, length, &length, &binaryFormat, &binary[0]);
+            const unsigned int format = binaryFormat;
+
+            // other threads, also of other processes sharing the directory,
+            // may store the same program at the same time, so write a file
+            // of our own and move it into place
+            char suffix[64];
+            std::snprintf(suffix, sizeof(suffix), ".%lx.%zx", static_cast<unsigned long>(getpid()),
+                          std::hash<std::thread::id>()(std::this_thread::get_id()));
+            const std::string tmpname = filename + suffix;
+
+            std::FILE* file = std::fopen(tmpname.c_str(), "wb");
+            if (!file)
+                return;
+            bool ok =    std::fwrite(magic, sizeof(magic), 1, file) == 1
+                      && std::fwrite(&format, sizeof(format), 1, file) == 1
+                      && std::fwrite(&binary[0], length, 1, file) == 1;
+            ok = std::fclose(file) == 0 && ok;
+
+            if (!ok || std::rename(tmpname.c_str(), filename.c_str()) != 0)
+                std::remove(tmpname.c_str());
+        }
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
@@ -0,0 +1,52 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// programBinaryCache.h
+//
+// on-disk cache of the binaries of GLSL programs
+//
+
+#ifndef __OpenCSG__program_binary_cache_h__
+#define __OpenCSG__program_binary_cache_h__
+
+#include "opencsgConfig.h"
+#include "openglExt.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        // Loads the binary of the GLSL program built from the given shader
+        // sources from the cache directory (see setProgramBinaryCache())
+        // into program. Returns false if the cache is disabled, holds no
+        // binary for the sources and the current driver, or the driver
+        // rejects it. In this case, program must be compiled and linked
+        // as usual, and is prepared such that its binary can be retrieved
+        // by storeProgramBinary() afterwards.
+        bool loadProgramBinary(GLuint program, const char* vertexShader, const char* fragmentShader);
+
+        // Stores the binary of the linked program, built from the given
+        // shader sources, in the cache directory.
+        void storeProgramBinary(GLuint program, const char* vertexShader, const char* fragmentShader);
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__program_binary_cache_h__
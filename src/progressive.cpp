@@ -0,0 +1,336 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// progressive.cpp
+//
+
+#include "opencsgConfig.h"
+#include "progressive.h"
+#include "context.h"
+#include "frameBufferObject.h"
+#include "openglHelper.h"
+#include "settings.h"
+#include "stateMemo.h"
+#include <algorithm>
+#include <chrono>
+
+namespace OpenCSG {
+
+    namespace Progressive {
+
+        thread_local Progress* current = 0;
+
+        Progress::Progress()
+          : step(0),
+            converged(false),
+            depthComplexity(-1),
+            stencilRef(0),
+            shapesWithoutUpdate(0),
+            offscreenBuffer(0),
+            framebuffer(0),
+            depthTexture(0),
+            width(0),
+            height(0)
+        {
+        }
+
+        Progress::~Progress() {
+            delete offscreenBuffer;
+            if (framebuffer) {
+                glDeleteFramebuffers(1, &framebuffer);
+                glDeleteTextures(1, &depthTexture);
+            }
+        }
+
+        Cache::Cache() : mVertexArray(0) {
+        }
+
+        Cache::~Cache() {
+            for (std::map<std::vector<Primitive*>, Progress*>::iterator itr = mProgress.begin(); itr != mProgress.end(); ++itr)
+                delete itr->second;
+            if (mVertexArray)
+                glDeleteVertexArrays(1, &mVertexArray);
+        }
+
+        Progress* Cache::get(const std::vector<Primitive*>& primitives) {
+            std::map<std::vector<Primitive*>, Progress*>::iterator itr = mProgress.find(primitives);
+            if (itr != mProgress.end())
+                return itr->second;
+
+            if (mProgress.size() >= MaxProducts) {
+                for (itr = mProgress.begin(); itr != mProgress.end(); ++itr)
+                    delete itr->second;
+                mProgress.clear();
+            }
+
+            Progress* progress = new Progress;
+            mProgress.insert(std::make_pair(primitives, progress));
+            return progress;
+        }
+
+        std::size_t Cache::bytes() const {
+            std::size_t result = 0;
+            for (std::map<std::vector<Primitive*>, Progress*>::const_iterator itr = mProgress.begin(); itr != mProgress.end(); ++itr) {
+                const Progress* progress = itr->second;
+                if (progress->offscreenBuffer && progress->offscreenBuffer->IsInitialized())
+                    result += static_cast<std::size_t>(progress->offscreenBuffer->GetWidth())
+                            * static_cast<std::size_t>(progress->offscreenBuffer->GetHeight()) * OpenGL::offscreenBytesPerPixel;
+                // GL_DEPTH24_STENCIL8
+                result += static_cast<std::size_t>(progress->width) * static_cast<std::size_t>(progress->height) * 4;
+            }
+            return result;
+        }
+
+        GLuint Cache::getVertexArray() {
+            if (!mVertexArray)
+                glGenVertexArrays(1, &mVertexArray);
+            return mVertexArray;
+        }
+
+        namespace {
+
+            double millisecondsNow() {
+                typedef std::chrono::steady_clock Clock;
+                return std::chrono::duration<double, std::milli>(Clock::now().time_since_epoch()).count();
+            }
+
+            thread_local double gStart = 0.0;
+            thread_local double gBudget = 0.0;
+            // the steps started in the current call
+            thread_local unsigned int gSteps = 0;
+            // signals the end of the step before the last one
+            thread_local GLsync gFence = 0;
+
+            // writes the depth values of the texture into the depth buffer,
+            // where they are nearer than the present ones
+            const char transferVertexShader[] =
+                "#version 150\n"
+                "void main() {\n"
+                "    vec2 position = vec2(float((gl_VertexID & 1) * 4 - 1), float((gl_VertexID & 2) * 2 - 1));\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n";
+
+            const char transferFragmentShader[] =
+                "#version 150\n"
+                "uniform sampler2D depthTexture;\n"
+                "void main() {\n"
+                "    gl_FragDepth = texelFetch(depthTexture, ivec2(gl_FragCoord.xy), 0).r;\n"
+                "}\n";
+
+            thread_local GLint gOldFramebuffer = 0;
+            // the state of the application, saved before binding the private
+            // framebuffer, since OpenGL may clamp the stencil reference value
+            // that is read back to the stencil bits of the bound framebuffer
+            thread_local OpenGL::StateMemo* gStateMemo = 0;
+
+        } // unnamed namespace
+
+        void begin(double milliseconds) {
+            gStart = millisecondsNow();
+            gBudget = milliseconds;
+            gSteps = 0;
+        }
+
+        void end() {
+            if (gFence) {
+                glDeleteSync(gFence);
+                gFence = 0;
+            }
+        }
+
+        void restartIfChanged(const std::vector<Primitive*>& primitives,
+                              Algorithm algorithm,
+                              DepthComplexityAlgorithm depthComplexityAlgorithm)
+        {
+            std::vector<double> signature;
+            signature.reserve(48 + 8 * primitives.size());
+            signature.push_back(algorithm);
+            signature.push_back(depthComplexityAlgorithm);
+            signature.push_back(getOption(OffscreenSetting));
+            signature.push_back(getOption(DepthBoundsOptimization));
+            signature.push_back(getOption(CameraOutsideOptimization));
+            signature.insert(signature.end(), OpenGL::modelview, OpenGL::modelview + 16);
+            signature.insert(signature.end(), OpenGL::projection, OpenGL::projection + 16);
+            signature.insert(signature.end(), OpenGL::canvasPos, OpenGL::canvasPos + 4);
+            GLint scissorBox[4] = { 0, 0, 0, 0 };
+            if (glIsEnabled(GL_SCISSOR_TEST))
+                glGetIntegerv(GL_SCISSOR_BOX, scissorBox);
+            signature.insert(signature.end(), scissorBox, scissorBox + 4);
+            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+                float minx, miny, minz, maxx, maxy, maxz;
+                (*itr)->getBoundingBox(minx, miny, minz, maxx, maxy, maxz);
+                signature.push_back((*itr)->getOperation());
+                signature.push_back((*itr)->getConvexity());
+                signature.push_back(minx);
+                signature.push_back(miny);
+                signature.push_back(minz);
+                signature.push_back(maxx);
+                signature.push_back(maxy);
+                signature.push_back(maxz);
+            }
+
+            const char* vertexShader = getVertexShader();
+            const std::string shader = vertexShader ? vertexShader : "";
+
+            if (signature == current->signature && shader == current->vertexShader)
+                return;
+
+            current->signature.swap(signature);
+            current->vertexShader = shader;
+            current->step = 0;
+            current->converged = false;
+            current->depthComplexity = -1;
+            current->stencilRef = 0;
+            current->fragmentCount.clear();
+            current->shapesWithoutUpdate = 0;
+        }
+
+        std::size_t firstStep() {
+            return current ? current->step : 0;
+        }
+
+        bool proceed() {
+            if (!current)
+                return true;
+
+            if (gSteps > 0) {
+                // Wait until the step before the last one has finished, so one
+                // step stays in flight. The time of the steps finished so far
+                // predicts whether the last step and the next one fit into
+                // the budget.
+                // A step that has not finished when the budget is spent ends
+                // the call, rather than blocking beyond the budget.
+                GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                GLenum waited = GL_ALREADY_SIGNALED;
+                if (gFence) {
+                    const double remaining = (std::max)(0.0, gBudget - (millisecondsNow() - gStart));
+                    const GLuint64 timeout = static_cast<GLuint64>(remaining * 1.0e6);
+                    waited = glClientWaitSync(gFence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+                    glDeleteSync(gFence);
+                }
+                gFence = fence;
+                if (waited == GL_TIMEOUT_EXPIRED || waited == GL_WAIT_FAILED)
+                    return false;
+
+                const unsigned int finished = gSteps - 1;
+                const double elapsed = millisecondsNow() - gStart;
+                const double perStep = finished > 0 ? elapsed / finished : 0.0;
+                if (elapsed + 2.0 * perStep > gBudget)
+                    return false;
+            }
+
+            ++gSteps;
+            ++current->step;
+            return true;
+        }
+
+        void finish() {
+            if (current)
+                current->converged = true;
+        }
+
+        OpenGL::OffscreenBuffer* getOffscreenBuffer() {
+            if (!current)
+                return 0;
+            if (!current->offscreenBuffer)
+                current->offscreenBuffer = new OpenGL::FrameBufferObject;
+            return current->offscreenBuffer;
+        }
+
+        void beginAccumulation() {
+            glGetIntegerv(GL_FRAMEBUFFER_BINDING, &gOldFramebuffer);
+            gStateMemo = new OpenGL::StateMemo;
+
+            // the framebuffer covers the viewport in window coordinates, such
+            // that the scissor box of the application applies unchanged
+            const int width = OpenGL::canvasPos[0] + OpenGL::canvasPos[2];
+            const int height = OpenGL::canvasPos[1] + OpenGL::canvasPos[3];
+            if (!current->framebuffer || current->width != width || current->height != height) {
+                if (!current->framebuffer) {
+                    glGenFramebuffers(1, &current->framebuffer);
+                    glGenTextures(1, &current->depthTexture);
+                }
+                current->width = width;
+                current->height = height;
+
+                GLint oldTexture = 0;
+                glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldTexture);
+                glBindTexture(GL_TEXTURE_2D, current->depthTexture);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, width, height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, 0);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+                glBindTexture(GL_TEXTURE_2D, oldTexture);
+
+                glBindFramebuffer(GL_FRAMEBUFFER, current->framebuffer);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, current->depthTexture, 0);
+                glDrawBuffer(GL_NONE);
+                glReadBuffer(GL_NONE);
+            }
+
+            glBindFramebuffer(GL_FRAMEBUFFER, current->framebuffer);
+
+            if (current->step == 0) {
+                glDisable(GL_SCISSOR_TEST);
+                glDepthMask(GL_TRUE);
+                glStencilMask(0xffffffff);
+                glClearDepth(1.0);
+                glClearStencil(0);
+                glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+                gStateMemo->restore();
+            }
+        }
+
+        void endAccumulation() {
+            glBindFramebuffer(GL_FRAMEBUFFER, gOldFramebuffer);
+
+            GLuint program = OpenGL::getGLSLProgram(transferVertexShader, transferVertexShader, transferFragmentShader);
+            glUseProgram(program);
+            glUniform1i(OpenGL::getGLSLProgramUniforms(program).depthTexture, 0);
+            glBindTexture(GL_TEXTURE_2D, current->depthTexture);
+            glBindVertexArray(OpenGL::getProgressiveCache()->getVertexArray());
+
+            // the fragment shader writes no color, so the alpha value is undefined
+            const GLboolean alphaTest = !OpenGL::isCoreProfile() && glIsEnabled(GL_ALPHA_TEST);
+            if (alphaTest)
+                glDisable(GL_ALPHA_TEST);
+
+            glEnable(GL_DEPTH_TEST);
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_TRUE);
+            glDepthRange(0.0, 1.0);
+            glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            glDisable(GL_STENCIL_TEST);
+            glDisable(GL_CULL_FACE);
+            glDisable(GL_BLEND);
+            if (OPENCSG_HAS_EXT(EXT_depth_bounds_test))
+                glDisable(GL_DEPTH_BOUNDS_TEST_EXT);
+
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+
+            if (alphaTest)
+                glEnable(GL_ALPHA_TEST);
+            gStateMemo->restore();
+            delete gStateMemo;
+            gStateMemo = 0;
+        }
+
+    } // namespace Progressive
+
+} // namespace OpenCSG
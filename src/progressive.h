@@ -0,0 +1,167 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// progressive.h
+//
+// state of the time-budgeted rendering with renderProgressive(),
+// which is resumed in the next call
+//
+
+#ifndef __OpenCSG__progressive_h__
+#define __OpenCSG__progressive_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglExt.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace OpenCSG {
+
+    /// redeclared from opencsg.h
+    bool renderProgressive(const std::vector<Primitive*>& primitives, double milliseconds);
+
+    namespace OpenGL {
+        class OffscreenBuffer;
+    }
+
+    namespace Progressive {
+
+        /// The progress of rendering a CSG product with renderProgressive().
+        /// The CSG algorithms are split into steps: for SCS, step 0 renders
+        /// the front faces of the intersected primitives, and step i > 0 the
+        /// iteration i - 1 of the subtraction sequence. For Goldfeather, a
+        /// step renders one layer of a batch.
+        struct Progress {
+            Progress();
+            /// deletes the offscreen buffers. The context must be current.
+            ~Progress();
+
+            /// the settings, matrices, viewport and bounding boxes of the
+            /// primitives of the last call. If any of them changes, rendering
+            /// starts from scratch.
+            std::vector<double> signature;
+            std::string vertexShader;
+
+            /// number of steps rendered so far
+            std::size_t step;
+            /// true if all steps have been rendered
+            bool converged;
+
+            /// the sampled depth complexity, or -1 if not sampled yet
+            int depthComplexity;
+            /// the stencil reference value of the SCS subtraction
+            unsigned int stencilRef;
+            /// the fragment counts of the subtracted batches and the number
+            /// of iterations without change, for SCS with occlusion queries
+            std::vector<unsigned int> fragmentCount;
+            unsigned int shapesWithoutUpdate;
+
+            /// keeps the depth and ID buffers of SCS between the calls
+            OpenGL::OffscreenBuffer* offscreenBuffer;
+
+            /// keeps the depth buffer merged by Goldfeather between the calls
+            GLuint framebuffer;
+            GLuint depthTexture;
+            int width;
+            int height;
+
+        private:
+            Progress(const Progress&);
+            Progress& operator=(const Progress&);
+        };
+
+        /// The progress of all CSG products rendered with renderProgressive()
+        /// in an OpenCSG context, identified by their array of primitives. If
+        /// there are more than MaxProducts, all are forgotten.
+        class Cache {
+        public:
+            enum { MaxProducts = 8 };
+
+            Cache();
+            /// deletes the progress of all products. The context must be current.
+            ~Cache();
+
+            /// returns the progress of rendering the primitives
+            Progress* get(const std::vector<Primitive*>& primitives);
+
+            /// returns the memory of the offscreen buffers and depth
+            /// textures kept for all products, which counts for the
+            /// memory budget of the offscreen buffers
+            std::size_t bytes() const;
+
+            /// returns an empty vertex array object, for drawing a full
+            /// screen triangle computed from gl_VertexID
+            GLuint getVertexArray();
+
+        private:
+            Cache(const Cache&);
+            Cache& operator=(const Cache&);
+
+            std::map<std::vector<Primitive*>, Progress*> mProgress;
+            GLuint mVertexArray;
+        };
+
+        /// the progress of the current call of renderProgressive(),
+        /// or 0 in render()
+        extern thread_local Progress* current;
+
+        /// starts the time budget of a call of renderProgressive()
+        void begin(double milliseconds);
+        /// ends the time budget
+        void end();
+
+        /// discards the progress if the algorithm, the settings, the
+        /// matrices, the viewport or the primitives have changed since the
+        /// last call. The matrices must have been fetched and the bounding
+        /// boxes projected.
+        void restartIfChanged(const std::vector<Primitive*>& primitives,
+                              Algorithm algorithm,
+                              DepthComplexityAlgorithm depthComplexityAlgorithm);
+
+        /// returns the first step that has not been rendered yet, or 0 in render()
+        std::size_t firstStep();
+
+        /// Called by the CSG algorithms before rendering a step. Returns
+        /// false if the time budget is spent, so the step is left for the
+        /// next call. At least one step is rendered per call. In render(),
+        /// always returns true.
+        bool proceed();
+
+        /// Called by the CSG algorithms after having rendered the last step.
+        void finish();
+
+        /// returns the offscreen buffer that keeps the state of SCS between
+        /// the calls, or 0 in render()
+        OpenGL::OffscreenBuffer* getOffscreenBuffer();
+
+        /// binds the framebuffer into which the Goldfeather algorithm merges
+        /// its layers. In the first step, the framebuffer is cleared.
+        void beginAccumulation();
+        /// binds the framebuffer of the application again, and merges the
+        /// depth values accumulated so far into its depth buffer.
+        void endAccumulation();
+
+    } // namespace Progressive
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__progressive_h__
@@ -0,0 +1,335 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// projection.cpp
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglHelper.h"
+#include "projection.h"
+#include <algorithm>
+
+namespace OpenCSG {
+
+    namespace Algo {
+
+        namespace {
+
+            // corner k of a box is min + sx[k] * dx + sy[k] * dy + sz[k] * dz
+            const float sx[8] = { 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f };
+            const float sy[8] = { 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f };
+            const float sz[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+
+            // the twelve edges of a box, as pairs of corner indices
+            const int edges[12][2] = {
+                { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+                { 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+                { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+            };
+
+            inline float clamp(float v, float lo) {
+                return (std::min)(1.0f, (std::max)(lo, v));
+            }
+
+            // whether any of the points, transformed into clip coordinates
+            // with matrix, is on or in front of the near plane z = -w
+            bool reachesNearPlane(const float m[16], const float* points, unsigned int count) {
+                for (unsigned int k = 0; k < count; ++k) {
+                    const float px = points[3 * k], py = points[3 * k + 1], pz = points[3 * k + 2];
+                    const float z = m[2] * px + m[6] * py + m[10] * pz + m[14];
+                    const float w = m[3] * px + m[7] * py + m[11] * pz + m[15];
+                    if (z + w <= 0.0f || w <= 0.0f) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        } // unnamed namespace
+
+        void multMatrix(const float a[16], const float b[16], float result[16]) {
+            for (int col = 0; col < 4; ++col) {
+                for (int row = 0; row < 4; ++row) {
+                    result[4 * col + row] = a[row     ] * b[4 * col    ]
+                                          + a[row +  4] * b[4 * col + 1]
+                                          + a[row +  8] * b[4 * col + 2]
+                                          + a[row + 12] * b[4 * col + 3];
+                }
+            }
+        }
+
+        bool projectBox(const float m[16], const float box[6], float ndcBox[6]) {
+            // clip coordinates of the min corner and of the three box edges.
+            // The eight corners then only need additions, in a loop of fixed
+            // length without branches that the compiler can vectorize.
+            const float dx = box[3] - box[0];
+            const float dy = box[4] - box[1];
+            const float dz = box[5] - box[2];
+            float o[4], ex[4], ey[4], ez[4];
+            for (int i = 0; i < 4; ++i) {
+                o[i]  = m[i] * box[0] + m[4 + i] * box[1] + m[8 + i] * box[2] + m[12 + i];
+                ex[i] = m[i] * dx;
+                ey[i] = m[4 + i] * dy;
+                ez[i] = m[8 + i] * dz;
+            }
+
+            float x[8], y[8], z[8], w[8];
+            for (int k = 0; k < 8; ++k) {
+                x[k] = o[0] + sx[k] * ex[0] + sy[k] * ey[0] + sz[k] * ez[0];
+                y[k] = o[1] + sx[k] * ex[1] + sy[k] * ey[1] + sz[k] * ez[1];
+                z[k] = o[2] + sx[k] * ex[2] + sy[k] * ey[2] + sz[k] * ez[2];
+                w[k] = o[3] + sx[k] * ex[3] + sy[k] * ey[3] + sz[k] * ez[3];
+            }
+
+            // signed distance to the near plane z = -w in clip coordinates
+            float d[8];
+            float minD = 0.0f;
+            for (int k = 0; k < 8; ++k) {
+                d[k] = z[k] + w[k];
+                minD = (std::min)(minD, d[k]);
+            }
+
+            float minx =  1.0f, miny =  1.0f, minz =  1.0f;
+            float maxx = -1.0f, maxy = -1.0f, maxz = -1.0f;
+            bool visible = false;
+
+            if (minD >= 0.0f) {
+                // common case: the box is completely behind the near plane
+                for (int k = 0; k < 8; ++k) {
+                    if (w[k] <= 0.0f) {
+                        return false;
+                    }
+                    const float invW = 1.0f / w[k];
+                    minx = (std::min)(minx, x[k] * invW); maxx = (std::max)(maxx, x[k] * invW);
+                    miny = (std::min)(miny, y[k] * invW); maxy = (std::max)(maxy, y[k] * invW);
+                    minz = (std::min)(minz, z[k] * invW); maxz = (std::max)(maxz, z[k] * invW);
+                }
+                visible = true;
+            } else {
+                // the box is clipped at the near plane: use the corners
+                // behind it and the intersections of the edges with it
+                float px[20], py[20], pz[20], pw[20];
+                int n = 0;
+                for (int k = 0; k < 8; ++k) {
+                    if (d[k] >= 0.0f) {
+                        px[n] = x[k]; py[n] = y[k]; pz[n] = z[k]; pw[n] = w[k];
+                        ++n;
+                    }
+                }
+                for (int e = 0; e < 12; ++e) {
+                    const int a = edges[e][0];
+                    const int b = edges[e][1];
+                    if ((d[a] < 0.0f) != (d[b] < 0.0f)) {
+                        const float t = d[a] / (d[a] - d[b]);
+                        px[n] = x[a] + t * (x[b] - x[a]);
+                        py[n] = y[a] + t * (y[b] - y[a]);
+                        pz[n] = z[a] + t * (z[b] - z[a]);
+                        pw[n] = w[a] + t * (w[b] - w[a]);
+                        ++n;
+                    }
+                }
+                for (int k = 0; k < n; ++k) {
+                    if (pw[k] <= 0.0f) {
+                        // only with unusual projection matrices
+                        minx = miny = minz = -1.0f;
+                        maxx = maxy = maxz =  1.0f;
+                        break;
+                    }
+                    const float invW = 1.0f / pw[k];
+                    minx = (std::min)(minx, px[k] * invW); maxx = (std::max)(maxx, px[k] * invW);
+                    miny = (std::min)(miny, py[k] * invW); maxy = (std::max)(maxy, py[k] * invW);
+                    minz = (std::min)(minz, pz[k] * invW); maxz = (std::max)(maxz, pz[k] * invW);
+                }
+                visible = n > 0;
+            }
+
+            if (!visible) {
+                return false;
+            }
+
+            // like ScissorMemo, z is a depth value in [0, 1]
+            ndcBox[0] = clamp(minx, -1.0f);
+            ndcBox[1] = clamp(miny, -1.0f);
+            ndcBox[2] = clamp(0.5f * minz + 0.5f, 0.0f);
+            ndcBox[3] = clamp(maxx, -1.0f);
+            ndcBox[4] = clamp(maxy, -1.0f);
+            ndcBox[5] = clamp(0.5f * maxz + 0.5f, 0.0f);
+            return true;
+        }
+
+        bool projectPoints(const float m[16], const float* points, unsigned int count, float ndcBox[6]) {
+            // the points are processed in blocks of fixed size, such that
+            // the inner loops can be vectorized by the compiler
+            const unsigned int blockSize = 16;
+            float x[blockSize], y[blockSize], z[blockSize], w[blockSize];
+
+            float minx =  1.0f, miny =  1.0f, minz =  1.0f;
+            float maxx = -1.0f, maxy = -1.0f, maxz = -1.0f;
+            float minD = 0.0f;
+            float minW = 1.0f;
+
+            for (unsigned int first = 0; first < count; first += blockSize) {
+                const unsigned int n = (std::min)(blockSize, count - first);
+                const float* p = points + 3 * first;
+                for (unsigned int k = 0; k < n; ++k) {
+                    const float px = p[3 * k], py = p[3 * k + 1], pz = p[3 * k + 2];
+                    x[k] = m[0] * px + m[4] * py + m[ 8] * pz + m[12];
+                    y[k] = m[1] * px + m[5] * py + m[ 9] * pz + m[13];
+                    z[k] = m[2] * px + m[6] * py + m[10] * pz + m[14];
+                    w[k] = m[3] * px + m[7] * py + m[11] * pz + m[15];
+                }
+                for (unsigned int k = 0; k < n; ++k) {
+                    minD = (std::min)(minD, z[k] + w[k]);
+                    minW = (std::min)(minW, w[k]);
+                }
+                if (minD < 0.0f || minW <= 0.0f) {
+                    return false;
+                }
+                for (unsigned int k = 0; k < n; ++k) {
+                    const float invW = 1.0f / w[k];
+                    x[k] *= invW;
+                    y[k] *= invW;
+                    z[k] *= invW;
+                }
+                for (unsigned int k = 0; k < n; ++k) {
+                    minx = (std::min)(minx, x[k]); maxx = (std::max)(maxx, x[k]);
+                    miny = (std::min)(miny, y[k]); maxy = (std::max)(maxy, y[k]);
+                    minz = (std::min)(minz, z[k]); maxz = (std::max)(maxz, z[k]);
+                }
+            }
+
+            if (count == 0) {
+                return false;
+            }
+
+            ndcBox[0] = clamp(minx, -1.0f);
+            ndcBox[1] = clamp(miny, -1.0f);
+            ndcBox[2] = clamp(0.5f * minz + 0.5f, 0.0f);
+            ndcBox[3] = clamp(maxx, -1.0f);
+            ndcBox[4] = clamp(maxy, -1.0f);
+            ndcBox[5] = clamp(0.5f * maxz + 0.5f, 0.0f);
+            return true;
+        }
+
+        void projectBoundingBoxes(const std::vector<Primitive*>& primitives) {
+            std::vector<ObjectSpace> objectSpace;
+            if (!getObjectSpace(primitives, objectSpace))
+                return;
+
+            float viewProjection[16];
+            multMatrix(OpenGL::projection, OpenGL::modelview, viewProjection);
+
+            const int n = static_cast<int>(primitives.size());
+
+            // each iteration only writes its own primitive. With OpenMP
+            // enabled (OPENCSG_OPENMP), large arrays are split among threads.
+#ifdef _OPENMP
+#pragma omp parallel for if (n > 4096) schedule(static)
+#endif
+            for (int i = 0; i < n; ++i) {
+                Primitive* primitive = primitives[i];
+                const ObjectSpace& data = objectSpace[i];
+                float box[6];
+                float matrix[16];
+                float ndcBox[6];
+
+                if (const float* points = data.hullPoints) {
+                    const unsigned int count = data.hullCount;
+                    multMatrix(viewProjection, data.hullTransform, matrix);
+                    if (projectPoints(matrix, points, count, ndcBox)) {
+                        primitive->setBoundingBox(ndcBox[0], ndcBox[1], ndcBox[2], ndcBox[3], ndcBox[4], ndcBox[5]);
+                        continue;
+                    }
+
+                    // clipped at the near plane: use the box around the points
+                    box[0] = box[3] = points[0];
+                    box[1] = box[4] = points[1];
+                    box[2] = box[5] = points[2];
+                    for (unsigned int k = 1; k < count; ++k) {
+                        for (int c = 0; c < 3; ++c) {
+                            box[c]     = (std::min)(box[c],     points[3 * k + c]);
+                            box[c + 3] = (std::max)(box[c + 3], points[3 * k + c]);
+                        }
+                    }
+                } else if (data.hasBoundingBox) {
+                    std::copy(data.boundingBox, data.boundingBox + 6, box);
+                    multMatrix(viewProjection, data.boundingBoxTransform, matrix);
+                } else {
+                    continue;
+                }
+
+                if (!projectBox(matrix, box, ndcBox)) {
+                    // invisible. An empty box at the border of the screen
+                    // does not overlap anything that is actually rendered.
+                    ndcBox[0] = ndcBox[3] = -1.0f;
+                    ndcBox[1] = ndcBox[4] = -1.0f;
+                    ndcBox[2] = ndcBox[5] =  0.0f;
+                }
+                primitive->setBoundingBox(ndcBox[0], ndcBox[1], ndcBox[2], ndcBox[3], ndcBox[4], ndcBox[5]);
+            }
+        }
+
+        bool mayBeClippedByNearPlane(const std::vector<Primitive*>& primitives) {
+            std::vector<ObjectSpace> objectSpace;
+            const bool haveObjectSpace = getObjectSpace(primitives, objectSpace);
+
+            float viewProjection[16];
+            multMatrix(OpenGL::projection, OpenGL::modelview, viewProjection);
+
+            for (std::size_t i = 0; i < primitives.size(); ++i) {
+                const Primitive* primitive = primitives[i];
+                const ObjectSpace* data = haveObjectSpace ? &objectSpace[i] : 0;
+                float matrix[16];
+
+                if (data && data->hullPoints) {
+                    multMatrix(viewProjection, data->hullTransform, matrix);
+                    if (reachesNearPlane(matrix, data->hullPoints, data->hullCount)) {
+                        return true;
+                    }
+                } else if (data && data->hasBoundingBox) {
+                    const float* box = data->boundingBox;
+                    multMatrix(viewProjection, data->boundingBoxTransform, matrix);
+                    float corners[24];
+                    for (int k = 0; k < 8; ++k) {
+                        corners[3 * k]     = box[0] + sx[k] * (box[3] - box[0]);
+                        corners[3 * k + 1] = box[1] + sy[k] * (box[4] - box[1]);
+                        corners[3 * k + 2] = box[2] + sz[k] * (box[5] - box[2]);
+                    }
+                    if (reachesNearPlane(matrix, corners, 8)) {
+                        return true;
+                    }
+                } else {
+                    // the depth of the near plane is 0. Primitives without
+                    // a bounding box cover the whole depth range.
+                    float minx, miny, minz, maxx, maxy, maxz;
+                    primitive->getBoundingBox(minx, miny, minz, maxx, maxy, maxz);
+                    if (minz <= 0.0f) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+    } // namespace Algo
+
+} // namespace OpenCSG
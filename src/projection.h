@@ -0,0 +1,94 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+
+//
+// projection.h
+//
+// computes bounding boxes in normalized device coordinates
+//
+
+#ifndef __OpenCSG__projection_h__
+#define __OpenCSG__projection_h__
+
+#include "opencsgConfig.h"
+#include <vector>
+
+namespace OpenCSG {
+
+    class Primitive;
+
+    namespace Algo {
+
+        /// multiplies the column-major 4x4 matrices a and b (result = a * b).
+        /// result must not alias a or b.
+        void multMatrix(const float a[16], const float b[16], float result[16]);
+
+        /// computes the bounding box of the axis aligned box (minx, miny,
+        /// minz, maxx, maxy, maxz), transformed into clip coordinates with
+        /// matrix. The box is clipped at the near plane. The result has x and
+        /// y in normalized device coordinates, clamped to [-1, 1], and z as
+        /// depth value in [0, 1], as expected by ScissorMemo for the depth
+        /// bounds test. Returns false if the box is completely in front of
+        /// the near plane.
+        bool projectBox(const float matrix[16], const float box[6], float ndcBox[6]);
+
+        /// computes the bounding box of count points (x, y, z triples),
+        /// transformed into clip coordinates with matrix, in the same form
+        /// as projectBox(). Returns false if any of the points is in front
+        /// of the near plane; then, no bounding box is computed.
+        bool projectPoints(const float matrix[16], const float* points, unsigned int count, float ndcBox[6]);
+
+        /// the bounding box in object coordinates and the hull points of a
+        /// primitive, see Primitive::getObjectBoundingBox() and
+        /// Primitive::getHullPoints()
+        struct ObjectSpace {
+            bool hasBoundingBox;
+            float boundingBox[6];
+            float boundingBoxTransform[16];
+            /// 0 if the primitive has no hull points
+            const float* hullPoints;
+            unsigned int hullCount;
+            float hullTransform[16];
+        };
+
+        /// fetches the object-space data of all primitives at once, taking
+        /// the lock of their table only once. For instances, these are the
+        /// data of the InstancedPrimitive with the transformation of the
+        /// instance applied. Returns false, leaving objectSpace unchanged,
+        /// if none of the primitives has any. Implemented in primitive.cpp.
+        bool getObjectSpace(const std::vector<Primitive*>& primitives, std::vector<ObjectSpace>& objectSpace);
+
+        /// sets the bounding box of all primitives that have hull points or
+        /// a bounding box in object coordinates, by projecting them with the
+        /// modelview and projection matrices in OpenGL::modelview and
+        /// OpenGL::projection
+        void projectBoundingBoxes(const std::vector<Primitive*>& primitives);
+
+        /// returns whether any of the primitives may be clipped by the near
+        /// plane, given the modelview and projection matrices in
+        /// OpenGL::modelview and OpenGL::projection. Uses the hull points or
+        /// the bounding box in object coordinates if set, else the depth
+        /// range of the bounding box of the primitive.
+        bool mayBeClippedByNearPlane(const std::vector<Primitive*>& primitives);
+
+    } // namespace Algo
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__projection_h__
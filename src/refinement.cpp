@@ -0,0 +1,329 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// refinement.cpp
+//
+// At reduced resolution, the visibility of each pixel of a primitive is
+// looked up at the texel of the offscreen buffer the pixel falls into.
+// This is only reliable if the 3x3 texels around that texel agree, since
+// otherwise an edge of the CSG product may pass through the pixel. The
+// GLSL merge programs therefore leave out such pixels. After each merge,
+// markEdges() renders one fragment per tile of edgeTileSize x edgeTileSize
+// pixels into a small edge mask, which is set if the texels covering the
+// tile (and their neighbors) do not all agree. At the end, the mask is
+// read back, and the marked tiles are computed again at full resolution
+// like the tiles of a large canvas, which fills in the pixels left out.
+//
+
+#include "opencsgConfig.h"
+#include "refinement.h"
+#include "context.h"
+#include "offscreenBuffer.h"
+#include "openglHelper.h"
+#include "settings.h"
+#include <algorithm>
+
+namespace OpenCSG {
+
+    namespace Refinement {
+
+        thread_local int divisor = 1;
+        thread_local bool refining = false;
+
+        namespace {
+
+            // edge length of the tiles in pixels, as in the shaders below
+            const int edgeTileSize = 64;
+
+            // whether the edge mask has been cleared since begin()
+            thread_local bool marked = false;
+            // whether the edge mask could not be used, so that the whole
+            // canvas needs to be refined
+            thread_local bool failed = false;
+
+            // Each fragment covers a tile of the canvas. texSizeInv maps
+            // window coordinates to texture coordinates as in the merge
+            // programs, texelSize is the size of a texel in texture
+            // coordinates, and texOffset the window position of the canvas.
+            // The texels are compared in a range two texels larger than
+            // those covering the tile, which includes the neighbors that
+            // the merge programs compare and leaves room for rounding.
+            // The loops are bounded for GLSL 1.10, 40 texels suffice for
+            // 64 pixels at half resolution.
+            const char edgeFragmentShader[] =
+                "#version 110\n"
+                "uniform sampler2D texture0;\n"
+                "uniform vec2 texSizeInv;\n"
+                "uniform vec2 texelSize;\n"
+                "uniform vec2 texOffset;\n"
+                "void main() {\n"
+                "    vec2 origin = floor(gl_FragCoord.xy) * 64.0 + texOffset;\n"
+                "    vec2 first = floor((origin + 0.5) * texSizeInv / texelSize) - 2.0;\n"
+                "    vec2 last = floor((origin + 63.5) * texSizeInv / texelSize) + 2.0;\n"
+                "    vec4 reference = texture2D(texture0, (first + 0.5) * texelSize);\n"
+                "    for (int y = 0; y < 40; ++y) {\n"
+                "        for (int x = 0; x < 40; ++x) {\n"
+                "            vec2 texel = first + vec2(float(x), float(y));\n"
+                "            if (texel.x > last.x)\n"
+                "                break;\n"
+                "            vec4 temp = texture2D(texture0, (texel + 0.5) * texelSize) - reference;\n"
+                "            if (dot(temp, temp) > 0.000001) {\n"
+                "                gl_FragColor = vec4(1.0);\n"
+                "                return;\n"
+                "            }\n"
+                "        }\n"
+                "        if (first.y + float(y) >= last.y)\n"
+                "            break;\n"
+                "    }\n"
+                "    discard;\n"
+                "}\n";
+
+            // Same as above, for core profile contexts
+            const char edgeFragmentShaderCore[] =
+                "#version 330 core\n"
+                "uniform sampler2D texture0;\n"
+                "uniform vec2 texSizeInv;\n"
+                "uniform vec2 texelSize;\n"
+                "uniform vec2 texOffset;\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    vec2 origin = floor(gl_FragCoord.xy) * 64.0 + texOffset;\n"
+                "    ivec2 first = ivec2(floor((origin + 0.5) * texSizeInv / texelSize)) - 2;\n"
+                "    ivec2 last = ivec2(floor((origin + 63.5) * texSizeInv / texelSize)) + 2;\n"
+                "    vec4 reference = texture(texture0, (vec2(first) + 0.5) * texelSize);\n"
+                "    for (int y = first.y; y <= last.y; ++y) {\n"
+                "        for (int x = first.x; x <= last.x; ++x) {\n"
+                "            vec4 temp = texture(texture0, (vec2(x, y) + 0.5) * texelSize) - reference;\n"
+                "            if (dot(temp, temp) > 0.000001) {\n"
+                "                fragColor = vec4(1.0);\n"
+                "                return;\n"
+                "            }\n"
+                "        }\n"
+                "    }\n"
+                "    discard;\n"
+                "}\n";
+
+            GLuint getEdgeProgram(bool wait = true) {
+                const char* vertexShader = OpenGL::quadVertexShader();
+                const char* fragmentShader = OpenGL::coreProfile ? edgeFragmentShaderCore : edgeFragmentShader;
+                return OpenGL::getGLSLProgram(fragmentShader, vertexShader, fragmentShader, wait);
+            }
+
+            // the size of the edge mask for the canvas
+            Dimensions maskDimensions() {
+                return Dimensions((OpenGL::canvasPos[2] + edgeTileSize - 1) / edgeTileSize,
+                                  (OpenGL::canvasPos[3] + edgeTileSize - 1) / edgeTileSize);
+            }
+
+            // saves the pixel pack state of the application and sets up
+            // tightly packed reading into client memory
+            class PixelPackMemo {
+            public:
+                PixelPackMemo() : mPackBuffer(0) {
+                    if (GLAD_GL_VERSION_2_1) {
+                        glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &mPackBuffer);
+                        if (mPackBuffer)
+                            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+                    }
+                    glGetIntegerv(GL_PACK_ALIGNMENT, &mAlignment);
+                    glGetIntegerv(GL_PACK_ROW_LENGTH, &mRowLength);
+                    glGetIntegerv(GL_PACK_SKIP_PIXELS, &mSkipPixels);
+                    glGetIntegerv(GL_PACK_SKIP_ROWS, &mSkipRows);
+                    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+                    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+                    glPixelStorei(GL_PACK_SKIP_PIXELS, 0);
+                    glPixelStorei(GL_PACK_SKIP_ROWS, 0);
+                }
+                ~PixelPackMemo() {
+                    glPixelStorei(GL_PACK_ALIGNMENT, mAlignment);
+                    glPixelStorei(GL_PACK_ROW_LENGTH, mRowLength);
+                    glPixelStorei(GL_PACK_SKIP_PIXELS, mSkipPixels);
+                    glPixelStorei(GL_PACK_SKIP_ROWS, mSkipRows);
+                    if (mPackBuffer)
+                        glBindBuffer(GL_PIXEL_PACK_BUFFER, mPackBuffer);
+                }
+            private:
+                GLint mPackBuffer;
+                GLint mAlignment;
+                GLint mRowLength;
+                GLint mSkipPixels;
+                GLint mSkipRows;
+            };
+
+        } // unnamed namespace
+
+        int chooseDivisor(const std::vector<Primitive*>& primitives) {
+            const int setting = getOption(ResolutionSetting);
+            switch (setting) {
+            case HalfResolution:
+                return 2;
+            case QuarterResolution:
+                return 4;
+            case HalfResolutionWhileMoving:
+            case QuarterResolutionWhileMoving:
+                OpenGL::fetchMatrices();
+                if (!OpenGL::isViewMoving(primitives))
+                    return 1;
+                return setting == HalfResolutionWhileMoving ? 2 : 4;
+            default:
+                return 1;
+            }
+        }
+
+        bool begin(int d) {
+            // the edge mask is a frame buffer object, which is read by GLSL
+            // programs. The merge programs for rectangular textures look
+            // up the texels at gl_FragCoord, which cannot be scaled.
+            if (!OPENCSG_HAS_EXT(ARB_framebuffer_object) && !GLAD_GL_VERSION_3_0)
+                return false;
+            if (!OpenGL::isCoreProfile() && !GLAD_GL_VERSION_2_0)
+                return false;
+            if (OpenGL::getCapabilities().rectangularOffscreenBuffers)
+                return false;
+
+            divisor = d;
+            marked = false;
+            failed = false;
+            return true;
+        }
+
+        void warmUp() {
+            if (OpenGL::coreProfile || GLAD_GL_VERSION_2_0)
+                getEdgeProgram(false);
+        }
+
+        void markEdges(OpenGL::OffscreenBuffer* buffer) {
+            if (failed)
+                return;
+
+            OpenGL::OffscreenBuffer* mask = OpenGL::getEdgeMaskBuffer();
+            const Dimensions dims = maskDimensions();
+            if (   !mask->ReadCurrent()
+                || (!mask->IsInitialized() && !mask->Initialize(dims))
+                || !mask->Resize(dims)
+            ) {
+                failed = true;
+                return;
+            }
+
+            const GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+            const GLboolean stencilTest = glIsEnabled(GL_STENCIL_TEST);
+            const GLboolean depthBoundsTest = OPENCSG_HAS_EXT(EXT_depth_bounds_test) ? glIsEnabled(GL_DEPTH_BOUNDS_TEST_EXT) : GL_FALSE;
+            GLboolean colorMask[4];
+            glGetBooleanv(GL_COLOR_WRITEMASK, colorMask);
+
+            mask->BeginCapture();
+            glViewport(0, 0, dims.width, dims.height);
+            glDisable(GL_DEPTH_TEST);
+            glDisable(GL_STENCIL_TEST);
+            glDisable(GL_SCISSOR_TEST);
+            if (depthBoundsTest)
+                glDisable(GL_DEPTH_BOUNDS_TEST_EXT);
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+            if (!marked) {
+                glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+                marked = true;
+            }
+
+            GLint viewport[4];
+            OpenGL::reducedViewport(divisor, viewport);
+            const float scaleX = static_cast<float>(viewport[2]) / static_cast<float>((std::max)(OpenGL::canvasPos[2], 1));
+            const float scaleY = static_cast<float>(viewport[3]) / static_cast<float>((std::max)(OpenGL::canvasPos[3], 1));
+            const float width = static_cast<float>((std::max)(buffer->GetWidth(), 1));
+            const float height = static_cast<float>((std::max)(buffer->GetHeight(), 1));
+
+            GLuint program = getEdgeProgram();
+            const OpenGL::ProgramUniforms& uniforms = OpenGL::getGLSLProgramUniforms(program);
+            // drawQuad() restores the current program
+            glUseProgram(program);
+            glUniform2f(uniforms.texSizeInv, scaleX / width, scaleY / height);
+            glUniform2f(uniforms.texelSize, 1.0f / width, 1.0f / height);
+            glUniform2f(uniforms.texOffset, static_cast<float>(OpenGL::canvasPos[0]), static_cast<float>(OpenGL::canvasPos[1]));
+            buffer->Bind();
+            OpenGL::drawQuad(program);
+
+            mask->EndCapture();
+            glViewport(OpenGL::canvasPos[0], OpenGL::canvasPos[1], OpenGL::canvasPos[2], OpenGL::canvasPos[3]);
+            if (depthTest)
+                glEnable(GL_DEPTH_TEST);
+            if (stencilTest)
+                glEnable(GL_STENCIL_TEST);
+            if (depthBoundsTest)
+                glEnable(GL_DEPTH_BOUNDS_TEST_EXT);
+            glColorMask(colorMask[0], colorMask[1], colorMask[2], colorMask[3]);
+        }
+
+        std::vector<PCArea> end() {
+            divisor = 1;
+
+            std::vector<PCArea> areas;
+            const int canvasWidth = OpenGL::canvasPos[2];
+            const int canvasHeight = OpenGL::canvasPos[3];
+            if (failed) {
+                areas.push_back(PCArea(0, 0, canvasWidth, canvasHeight));
+                return areas;
+            }
+            if (!marked)
+                return areas;
+
+            OpenGL::OffscreenBuffer* mask = OpenGL::getEdgeMaskBuffer();
+            const Dimensions dims = maskDimensions();
+            std::vector<GLubyte> pixels(4 * dims.width * dims.height);
+            {
+                PixelPackMemo memo;
+                mask->ReadCurrent();
+                mask->BeginCapture();
+                glReadPixels(0, 0, dims.width, dims.height, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+                mask->EndCapture();
+            }
+
+            // the marked tiles of each row are joined into runs
+            int markedTiles = 0;
+            for (int y = 0; y < dims.height; ++y) {
+                for (int x = 0; x < dims.width; ++x) {
+                    if (!pixels[4 * (y * dims.width + x)])
+                        continue;
+
+                    int last = x;
+                    while (last + 1 < dims.width && pixels[4 * (y * dims.width + last + 1)])
+                        ++last;
+                    markedTiles += last - x + 1;
+
+                    areas.push_back(PCArea(x * edgeTileSize,
+                                           y * edgeTileSize,
+                                           (std::min)((last + 1) * edgeTileSize, canvasWidth),
+                                           (std::min)((y + 1) * edgeTileSize, canvasHeight)));
+                    x = last;
+                }
+            }
+
+            // refining most of the canvas in one go is cheaper
+            if (2 * markedTiles > dims.width * dims.height) {
+                areas.clear();
+                areas.push_back(PCArea(0, 0, canvasWidth, canvasHeight));
+            }
+
+            return areas;
+        }
+
+    } // namespace Refinement
+
+} // namespace OpenCSG
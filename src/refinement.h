@@ -0,0 +1,79 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// refinement.h
+//
+// edge refinement of the CSG computation at reduced resolution
+// (see ResolutionSetting)
+//
+
+#ifndef __OpenCSG__refinement_h__
+#define __OpenCSG__refinement_h__
+
+#include "opencsgConfig.h"
+#include "area.h"
+#include <vector>
+
+namespace OpenCSG {
+
+    class Primitive;
+
+    namespace OpenGL {
+        class OffscreenBuffer;
+    }
+
+    namespace Refinement {
+
+        /// 2 or 4 while render() computes the CSG product at half or quarter
+        /// resolution, else 1. The GLSL merges then leave out the pixels next
+        /// to texels of different visibility, which are refined afterwards.
+        extern thread_local int divisor;
+
+        /// true while render() refines the edges tile by tile
+        extern thread_local bool refining;
+
+        /// returns the divisor of the resolution chosen by the
+        /// ResolutionSetting for the CSG product of the primitives in the
+        /// current view
+        int chooseDivisor(const std::vector<Primitive*>& primitives);
+
+        /// starts computing at the reduced resolution given by d.
+        /// Returns false if the edges could not be refined, i.e., if
+        /// frame buffer objects or GLSL are not available.
+        bool begin(int d);
+
+        /// starts building the GLSL program of markEdges() in the background
+        void warmUp();
+
+        /// marks the tiles that contain pixels left out by the merge of
+        /// the visibility in buffer. Called by the ChannelManager after
+        /// each merge at reduced resolution.
+        void markEdges(OpenGL::OffscreenBuffer* buffer);
+
+        /// ends the computation at reduced resolution, and returns the
+        /// areas of the canvas (in pixels relative to its origin) that are
+        /// to be rendered again at full resolution. Reads back the tiles
+        /// marked so far, which waits for the GPU.
+        std::vector<PCArea> end();
+
+    } // namespace Refinement
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__refinement_h__
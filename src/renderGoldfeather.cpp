@@ -31,8 +31,12 @@
 #include "occlusionQuery.h"
 #include "openglHelper.h"
 #include "primitiveHelper.h"
+#include "progressive.h"
+#include "refinement.h"
 #include "scissorMemo.h"
 #include "settings.h"
+#include "statistics.h"
+#include "trace.h"
 #include <algorithm>
 #include <cassert>
 
@@ -40,7 +44,7 @@ namespace OpenCSG {
 
     namespace {
 
-        ScissorMemo* scissor;
+        thread_local ScissorMemo* scissor;
 
         class GoldfeatherChannelManager : public ChannelManagerForBatches {
         public:
@@ -72,16 +76,14 @@ namespace OpenCSG {
                 if (getLayer(*c) == -1) {
                 
                     glEnable(GL_CULL_FACE);
-                    for (Batch::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
-                        glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
-                        (*j)->render();
-                    }
+                    OpenGL::renderBatchCulled(primitives);
                 } else {
                     // shapes of interest: we need to determine the appropriate layer of
                     // the shapes, using stencil counting
                     glClearStencil(0);
                     glStencilMask(OpenGL::stencilMask);
                     glClear(GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
                     OpenGL::renderLayer(getLayer(*c), primitives);
                     glDisable(GL_STENCIL_TEST);
                 }
@@ -102,16 +104,21 @@ namespace OpenCSG {
         class GoldfeatherChannelManagerGLSLProgram : public ChannelManagerForBatches {
         public:
             virtual void merge();
+        protected:
+            virtual bool refinesEdges() const { return true; }
         };
 
+        // At reduced resolution, the fragment is also discarded if the
+        // neighboring texels differ, see renderSCS.cpp
 
         static const char mergeFragmentProgramRect[] =
             "#version 110\n"
             "#extension GL_ARB_texture_rectangle : enable\n"
             "uniform sampler2DRect texture0;\n"
+            "uniform vec2 texOffset;\n"
             "uniform vec4 color;\n"
             "void main() {\n"
-            "    vec4 temp = texture2DRect(texture0, gl_FragCoord.xy);\n"
+            "    vec4 temp = texture2DRect(texture0, gl_FragCoord.xy - texOffset);\n"
             "    float d = dot(temp, color);\n"
             "    if (d < 0.5)\n"
             "        discard;\n"
@@ -122,36 +129,97 @@ namespace OpenCSG {
             "#version 110\n"
             "uniform sampler2D texture0;\n"
             "uniform vec2 texSizeInv;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec2 texelSize;\n"
             "uniform vec4 color;\n"
             "void main() {\n"
-            "    vec2 texCoord = vec2(gl_FragCoord.x * texSizeInv.x, gl_FragCoord.y * texSizeInv.y);\n"
+            "    vec2 texCoord = vec2((gl_FragCoord.x - texOffset.x) * texSizeInv.x, (gl_FragCoord.y - texOffset.y) * texSizeInv.y);\n"
             "    vec4 temp = texture2D(texture0, texCoord);\n"
+            "    if (texelSize.x > 0.0) {\n"
+            "        for (int y = -1; y <= 1; ++y) {\n"
+            "            for (int x = -1; x <= 1; ++x) {\n"
+            "                vec4 neighbor = texture2D(texture0, texCoord + vec2(float(x), float(y)) * texelSize) - temp;\n"
+            "                if (dot(neighbor, neighbor) > 0.000001)\n"
+            "                    discard;\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
             "    float d = dot(temp, color);\n"
             "    if (d < 0.5)\n"
             "        discard;\n"
             "    gl_FragColor = color;\n"
             "}\n";
 
-        void GoldfeatherChannelManagerGLSLProgram::merge()
+        // Same as above, for core profile contexts
+        static const char mergeFragmentProgramRectCore[] =
+            "#version 330 core\n"
+            "uniform sampler2DRect texture0;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec4 color;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec4 temp = texture(texture0, gl_FragCoord.xy - texOffset);\n"
+            "    float d = dot(temp, color);\n"
+            "    if (d < 0.5)\n"
+            "        discard;\n"
+            "    fragColor = color;\n"
+            "}\n";
+
+        static const char mergeFragmentProgram2DCore[] =
+            "#version 330 core\n"
+            "uniform sampler2D texture0;\n"
+            "uniform vec2 texSizeInv;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec2 texelSize;\n"
+            "uniform vec4 color;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec2 texCoord = (gl_FragCoord.xy - texOffset) * texSizeInv;\n"
+            "    vec4 temp = texture(texture0, texCoord);\n"
+            "    if (texelSize.x > 0.0) {\n"
+            "        for (int y = -1; y <= 1; ++y) {\n"
+            "            for (int x = -1; x <= 1; ++x) {\n"
+            "                vec4 neighbor = texture(texture0, texCoord + vec2(x, y) * texelSize) - temp;\n"
+            "                if (dot(neighbor, neighbor) > 0.000001)\n"
+            "                    discard;\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    float d = dot(temp, color);\n"
+            "    if (d < 0.5)\n"
+            "        discard;\n"
+            "    fragColor = color;\n"
+            "}\n";
+
+        // returns 0 if not waiting for the program, which is still built
+        // in the background
+        GLuint getMergeProgram(bool rectangular, bool wait = true)
         {
             const int GFIdOffset = 0;
-            const char* programID = getVertexShader() + (isRectangularTexture() ? 1 : 0) + GFIdOffset;
-            GLuint glslProgram =
-                isRectangularTexture()
-                  ? OpenGL::getGLSLProgram(programID, getVertexShader(), mergeFragmentProgramRect)
-                  : OpenGL::getGLSLProgram(programID, getVertexShader(), mergeFragmentProgram2D);
+            const char* vertexShader = OpenGL::mergeVertexShader();
+            const char* programID = vertexShader + (rectangular ? 1 : 0) + GFIdOffset;
+            const char* fragmentShader =
+                OpenGL::coreProfile
+                  ? (rectangular ? mergeFragmentProgramRectCore : mergeFragmentProgram2DCore)
+                  : (rectangular ? mergeFragmentProgramRect : mergeFragmentProgram2D);
+            return OpenGL::getGLSLProgram(programID, vertexShader, fragmentShader, wait);
+        }
+
+        void GoldfeatherChannelManagerGLSLProgram::merge()
+        {
+            GLuint glslProgram = getMergeProgram(isRectangularTexture());
 
-            GLint col = glGetUniformLocation(glslProgram, "color");
-            GLint texSizeInv = -1;
-            if (!isRectangularTexture())
-                texSizeInv = glGetUniformLocation(glslProgram, "texSizeInv");
+            // the rectangular texture programs have no texSizeInv
+            const OpenGL::ProgramUniforms& uniforms = OpenGL::getGLSLProgramUniforms(glslProgram);
+            GLint col = uniforms.color;
 
-            glUseProgram(glslProgram);
+            OpenGL::useProgram(glslProgram);
 
             ProjTextureSetup setup = GLSLProgram;
-            setupProjectiveTexture(setup, texSizeInv);
+            setupProjectiveTexture(setup, uniforms.texSizeInv, uniforms.texOffset, uniforms.texelSize);
 
-            glDisable(GL_ALPHA_TEST);
+            if (!OpenGL::coreProfile)
+                glDisable(GL_ALPHA_TEST);
             glEnable(GL_CULL_FACE);
             glEnable(GL_DEPTH_TEST);
             glDepthFunc(GL_LESS);
@@ -191,10 +259,7 @@ namespace OpenCSG {
                 if (getLayer(*c) == -1) {
 
                     glEnable(GL_CULL_FACE);
-                    for (Batch::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
-                        glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
-                        (*j)->render();
-                    }
+                    OpenGL::renderBatchCulled(primitives);
                 }
                 else {
                     // shapes of interest: we need to determine the appropriate layer of
@@ -202,6 +267,7 @@ namespace OpenCSG {
                     glClearStencil(0);
                     glStencilMask(OpenGL::stencilMask);
                     glClear(GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
                     OpenGL::renderLayer(getLayer(*c), primitives);
                     glDisable(GL_STENCIL_TEST);
                 }
@@ -211,7 +277,7 @@ namespace OpenCSG {
 
             glDisable(GL_CULL_FACE);
             glDepthFunc(GL_LEQUAL);
-            glUseProgram(0);
+            OpenGL::resetProgram();
 
             resetProjectiveTexture(setup);
 
@@ -219,45 +285,25 @@ namespace OpenCSG {
         }
 
 
-        ChannelManagerForBatches* channelMgr;
+        thread_local ChannelManagerForBatches* channelMgr;
 
         void touchFragments(const Batch& batch) {
-            glMatrixMode(GL_PROJECTION);
-            glPushMatrix();
-            glLoadIdentity();
-            glMatrixMode(GL_MODELVIEW);
-            glPushMatrix();
-            glLoadIdentity();
-
-            GLboolean origVertexArrayState = glIsEnabled(GL_VERTEX_ARRAY);
-            if (!origVertexArrayState) {
-                glEnableClientState(GL_VERTEX_ARRAY);
-            }
+            std::vector<GLfloat> v;
+            v.reserve(8 * batch.size());
 
             for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
 
                 float fminx, fminy, fminz, fmaxx, fmaxy, fmaxz;
                 (*j)->getBoundingBox(fminx, fminy, fminz, fmaxx, fmaxy, fmaxz);
 
-                const GLfloat v[8] = {
-                    fminx, fminy,
-                    fmaxx, fminy,
-                    fminx, fmaxy,
-                    fmaxx, fmaxy
-                };
-
-                glVertexPointer(2, GL_FLOAT, 0, v);
-                glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-            }
-
-            if (!origVertexArrayState) {
-                glDisableClientState(GL_VERTEX_ARRAY);
+                v.push_back(fminx); v.push_back(fminy);
+                v.push_back(fmaxx); v.push_back(fminy);
+                v.push_back(fminx); v.push_back(fmaxy);
+                v.push_back(fmaxx); v.push_back(fmaxy);
             }
 
-            glMatrixMode(GL_PROJECTION);
-            glPopMatrix();
-            glMatrixMode(GL_MODELVIEW);
-            glPopMatrix();
+            if (!v.empty())
+                OpenGL::drawQuads(&v[0], static_cast<int>(batch.size()));
         }
 
         GLenum getParityDepthFunc()
@@ -277,7 +323,7 @@ namespace OpenCSG {
             glStencilFunc(GL_NOTEQUAL, parity, mask);
             glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
             channelMgr->renderToChannel(true);
-            glColor4ub(0, 0, 0, 0);
+            OpenGL::color4ub(0, 0, 0, 0);
 
             touchFragments(batch);
 
@@ -294,7 +340,7 @@ namespace OpenCSG {
             glStencilFunc(GL_NOTEQUAL, parity, mask);
             glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
             channelMgr->renderToChannel(true);
-            glColor4ub(0, 0, 0, 0);
+            OpenGL::color4ub(0, 0, 0, 0);
 
             OpenGL::drawQuad();
 
@@ -308,6 +354,8 @@ namespace OpenCSG {
                 int parity, int mask,
                 bool layered) {
 
+            OPENCSG_STATISTICS_PHASE(DiscardPhase);
+
             if (layered) {
                 discardFragments(parity, mask);
             } else {
@@ -317,6 +365,8 @@ namespace OpenCSG {
                 if (scissor->isDepthBoundsTestEnabled())
                     glEnable(GL_DEPTH_BOUNDS_TEST_EXT);
             }
+
+            OPENCSG_STATISTICS_PHASE(ParityPhase);
         }
 
         void parityTestAndDiscard(
@@ -325,6 +375,9 @@ namespace OpenCSG {
                 bool layered,
                 unsigned int stencilMax) {
 
+            OPENCSG_TRACE_SCOPE("Goldfeather.parity", -1);
+            OPENCSG_STATISTICS_PHASE(ParityPhase);
+
             glDepthMask(GL_FALSE);
             glDepthFunc(getParityDepthFunc());
 
@@ -389,6 +442,7 @@ namespace OpenCSG {
                 glStencilFunc(GL_ALWAYS, 0, parityValue);
                 glStencilMask(parityValue);
                 glStencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
+                OPENCSG_STATISTICS(++stats->renderCalls[ParityPhase]);
                 (*itr)->render();
 
                 // after the parity test, the reaction differs whether we have a
@@ -421,19 +475,34 @@ namespace OpenCSG {
         scissor = new ScissorMemo;
 
         Batcher batches(primitives);
+        OPENCSG_STATISTICS(stats->batches += static_cast<unsigned int>(batches.size()));
 
         scissor->setIntersected(primitives);
 
-        for (std::vector<Batch>::const_iterator itr = batches.begin(); itr != batches.end(); ++itr) {
+        // each layer of each batch is a step of renderProgressive()
+        const std::size_t firstStep = Progressive::firstStep();
+        std::size_t step = 0;
+        bool stopped = false;
+
+        for (std::vector<Batch>::const_iterator itr = batches.begin(); itr != batches.end() && !stopped; ++itr) {
+            OPENCSG_TRACE_SCOPE("Goldfeather.batch", static_cast<int>(itr - batches.begin()));
             unsigned int maxConvexity = Algo::getConvexity(*itr);
-            for (unsigned int currentLayer = 0; currentLayer < maxConvexity; ++currentLayer) {
-                
+            for (unsigned int currentLayer = 0; currentLayer < maxConvexity; ++currentLayer, ++step) {
+                if (step < firstStep)
+                    continue;
+                if (!Progressive::proceed()) {
+                    stopped = true;
+                    break;
+                }
+
+                OPENCSG_TRACE_SCOPE("Goldfeather.layer", static_cast<int>(currentLayer));
+
                 if (channelMgr->request() == NoChannel) {
                     channelMgr->free();
                     channelMgr->request();
                 }
 
-                channelMgr->renderToChannel(true); glColor4ub(255, 255, 255, 255);
+                channelMgr->renderToChannel(true); OpenGL::color4ub(255, 255, 255, 255);
                 glStencilMask(OpenGL::stencilMask);
                 glEnable(GL_STENCIL_TEST);
 
@@ -444,6 +513,8 @@ namespace OpenCSG {
                 scissor->store(channelMgr->current());
                 scissor->enableScissor();
 
+                OPENCSG_STATISTICS(++stats->layers);
+                OPENCSG_STATISTICS_PHASE(LayerPhase);
                 if (maxConvexity == 1) {
                     // shapes of interest: we need to determine which parts of them are visible.
                     // first assume they are fully visible
@@ -451,18 +522,18 @@ namespace OpenCSG {
                     glStencilOp(GL_REPLACE, GL_REPLACE, GL_REPLACE);
                     glEnable(GL_CULL_FACE);
 
-                    for (Batch::const_iterator j = itr->begin(); j != itr->end(); ++j) {
-                        glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
-                        (*j)->render();
-                    }
+                    // the order does not matter since primitives of a batch do not overlap
+                    OpenGL::renderBatchCulled(*itr);
 
                     glDisable(GL_CULL_FACE);
                 } else {
                     // shapes of interest: we need to determine the appropriate layer of 
                     // the shapes, using stencil counting
                     glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
                     OpenGL::renderLayer(currentLayer, *itr);
                     glClear(GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
                 }
 
                 GLenum depthFunc = getParityDepthFunc();
@@ -480,6 +551,9 @@ namespace OpenCSG {
             }
         }
 
+        if (!stopped)
+            Progressive::finish();
+
         channelMgr->free();
 
         delete scissor;
@@ -489,7 +563,9 @@ namespace OpenCSG {
     {
         scissor = new ScissorMemo;
 
-        unsigned int layer = 0;
+        // each layer is a step of renderProgressive()
+        unsigned int layer = static_cast<unsigned int>(Progressive::firstStep());
+        bool stopped = false;
 
         scissor->setIntersected(primitives);
         scissor->setCurrent(primitives);
@@ -499,6 +575,12 @@ namespace OpenCSG {
         bool retVal = true;
 
         while (true) {
+            if (!Progressive::proceed()) {
+                stopped = true;
+                break;
+            }
+
+            OPENCSG_TRACE_SCOPE("Goldfeather.layer", static_cast<int>(layer));
             if (channelMgr->request() == NoChannel) {
                 channelMgr->free();
                 channelMgr->request();
@@ -519,21 +601,26 @@ namespace OpenCSG {
 
             glStencilMask(OpenGL::stencilMask);
             glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
 
             glDepthFunc(GL_ALWAYS);
             glDepthMask(GL_TRUE);
-            glColor4ub(255, 255, 255, 255);
+            OpenGL::color4ub(255, 255, 255, 255);
 
+            OPENCSG_STATISTICS(++stats->layers);
+            OPENCSG_STATISTICS_PHASE(LayerPhase);
             occlusionTest->beginQuery();
             OpenGL::renderLayer(layer, primitives);
             occlusionTest->endQuery();
             // the fragment count query could occur here, but benches show that
             // the algorithm is faster if the query is delayed.
             glClear(GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
 
             parityTestAndDiscard(primitives, primitives, true, OpenGL::stencilMax);
 
             unsigned int anyFragmentRendered = occlusionTest->getQueryResult();
+            OPENCSG_STATISTICS(++stats->occlusionQueries; stats->occlusionQuerySamples += anyFragmentRendered);
             if (!anyFragmentRendered) {
                 retVal = true;
                 break;
@@ -556,6 +643,9 @@ namespace OpenCSG {
 
         delete occlusionTest;
 
+        if (retVal && !stopped)
+            Progressive::finish();
+
         channelMgr->free();
 
         delete scissor;
@@ -569,13 +659,29 @@ namespace OpenCSG {
 
         scissor->setIntersected(primitives);
         scissor->setCurrent(primitives);
-        scissor->enableScissor();
 
-        unsigned int depthComplexity = OpenGL::calcMaxDepthComplexity(primitives, scissor->getIntersectedArea());
+        // renderProgressive() samples the depth complexity only once
+        unsigned int depthComplexity = 0;
+        if (Progressive::current && Progressive::current->depthComplexity >= 0) {
+            depthComplexity = static_cast<unsigned int>(Progressive::current->depthComplexity);
+        } else {
+            scissor->enableScissor();
+            depthComplexity = OpenGL::calcMaxDepthComplexity(primitives, scissor->getIntersectedArea());
+            scissor->disableScissor();
+            if (Progressive::current)
+                Progressive::current->depthComplexity = static_cast<int>(depthComplexity);
+        }
+
+        // each layer is a step of renderProgressive()
+        bool stopped = false;
 
-        scissor->disableScissor();
+        for (unsigned int layer = static_cast<unsigned int>(Progressive::firstStep()); layer < depthComplexity; ++layer) {
+            if (!Progressive::proceed()) {
+                stopped = true;
+                break;
+            }
 
-        for (unsigned int layer = 0; layer < depthComplexity; ++layer) {
+            OPENCSG_TRACE_SCOPE("Goldfeather.layer", static_cast<int>(layer));
             if (channelMgr->request() == NoChannel) {
                 channelMgr->free();
                 channelMgr->request();
@@ -588,13 +694,17 @@ namespace OpenCSG {
 
             glStencilMask(OpenGL::stencilMask);
             glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
 
             glDepthFunc(GL_ALWAYS);
             glDepthMask(GL_TRUE);
-            glColor4ub(255, 255, 255, 255);
+            OpenGL::color4ub(255, 255, 255, 255);
+            OPENCSG_STATISTICS(++stats->layers);
+            OPENCSG_STATISTICS_PHASE(LayerPhase);
             OpenGL::renderLayer(layer, primitives);
 
             glClear(GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
 
             parityTestAndDiscard(primitives, primitives, true, OpenGL::stencilMax);
 
@@ -603,6 +713,9 @@ namespace OpenCSG {
             scissor->disableScissor();
         }
 
+        if (!stopped)
+            Progressive::finish();
+
         channelMgr->free();
 
         delete scissor;
@@ -610,9 +723,19 @@ namespace OpenCSG {
 
     static ChannelManagerForBatches* getChannelManager() {
 
+        // Only GLSL is available in core profile contexts
+        OpenGL::coreProfile = OpenGL::isCoreProfile();
+        if (OpenGL::coreProfile)
+            return new GoldfeatherChannelManagerGLSLProgram;
+
         if (GLAD_GL_VERSION_2_0)
         {
-            bool useGLSL = getVertexShader() != 0;
+            // while the merge program for the vertex shader is still
+            // built in the background, merge with the fixed function
+            // pipeline. Without a vertex shader, the GLSL program is only
+            // needed for refining the edges at reduced resolution.
+            bool useGLSL =    (getVertexShader() != 0 || Refinement::divisor > 1)
+                           && getMergeProgram(OpenGL::getCapabilities().rectangularOffscreenBuffers, false) != 0;
             if (useGLSL)
                 return new GoldfeatherChannelManagerGLSLProgram;
         }
@@ -622,6 +745,8 @@ namespace OpenCSG {
 
     void renderGoldfeather(const std::vector<Primitive*>& primitives, DepthComplexityAlgorithm algorithm)
     {
+        OPENCSG_TRACE_SCOPE("Goldfeather.render", -1);
+
         channelMgr = getChannelManager();
 
         if (channelMgr->init())
@@ -645,4 +770,15 @@ namespace OpenCSG {
         delete channelMgr;
     }
 
+    void warmUpGoldfeather(bool rectangular) {
+        // the same choice of the merge programs as in getChannelManager()
+        if (   OpenGL::coreProfile
+            || (GLAD_GL_VERSION_2_0 && (getVertexShader() || getOption(ResolutionSetting) != FullResolution))
+        ) {
+            getMergeProgram(false, false);
+            if (rectangular)
+                getMergeProgram(true, false);
+        }
+    }
+
 } // namespace OpenCSG
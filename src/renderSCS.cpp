@@ -31,19 +31,22 @@
 #include "occlusionQuery.h"
 #include "openglHelper.h"
 #include "primitiveHelper.h"
+#include "progressive.h"
+#include "refinement.h"
 #include "scissorMemo.h"
 #include "sequencer.h"
 #include "settings.h"
+#include "statistics.h"
+#include "trace.h"
 
 #include <algorithm>
 #include <map>
-#include <string>
 
 namespace OpenCSG {
 
     namespace {
 
-        ScissorMemo* scissor;
+        thread_local ScissorMemo* scissor;
 
         struct IdBufferId {
             GLubyte r;
@@ -53,13 +56,17 @@ namespace OpenCSG {
             GLubyte* vec() {
                 return &r;
             }
+            GLuint value() const {
+                return (static_cast<GLuint>(r) << 24) | (static_cast<GLuint>(g) << 16)
+                     | (static_cast<GLuint>(b) <<  8) |  static_cast<GLuint>(a);
+            }
         };
 
         struct RenderData {
             IdBufferId bufferId;
         };
 
-        std::map<Primitive*, RenderData> gRenderInfo;
+        thread_local std::map<Primitive*, RenderData> gRenderInfo;
 
         RenderData* getRenderData(Primitive* primitive) {
             RenderData* dta = &(gRenderInfo.find(primitive))->second;
@@ -92,6 +99,7 @@ namespace OpenCSG {
                 scissor->enableScissor();
 
                 const std::vector<Primitive*> primitives = getPrimitives(*c);
+                OPENCSG_STATISTICS(stats->renderCalls[MergePhase] += static_cast<unsigned int>(primitives.size()));
                 for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
                     glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
                     RenderData* primitiveData = getRenderData(*j);
@@ -191,6 +199,10 @@ namespace OpenCSG {
         // This way, all 32-bits of the color channel can be used
         // for an 'equal' alpha test, i.e, to check if value in texture
         // and color are equal.
+        // At reduced resolution, the fragment is also discarded if the
+        // neighboring texels differ, since an edge of the CSG product may
+        // pass through it. Such edges are refined at full resolution,
+        // see refinement.cpp.
 
         // Note that 1.0f/255.0f cannot be the result of the above computation.
         // Either the result is 0 (if all components were equal, disregarding
@@ -225,6 +237,13 @@ namespace OpenCSG {
 "DP4     out, temp, scaleByTwo;\n"
 "END";
 
+        GLuint getMergeARBFragmentProgram(bool rectangular)
+        {
+            return rectangular
+                ? OpenGL::getARBFragmentProgram(mergeARBFragmentProgramRect, (sizeof(mergeARBFragmentProgramRect) / sizeof(mergeARBFragmentProgramRect[0])) - 1)
+                : OpenGL::getARBFragmentProgram(mergeARBFragmentProgram2D, (sizeof(mergeARBFragmentProgram2D) / sizeof(mergeARBFragmentProgram2D[0])) - 1);
+        }
+
         void SCSChannelManagerARBProgram::merge()
         {
             if (mProjTextureSetup == ARBShader)
@@ -234,10 +253,7 @@ namespace OpenCSG {
                 glEnable(GL_VERTEX_PROGRAM_ARB);
             }
 
-            GLuint fId =
-                isRectangularTexture()
-                  ? OpenGL::getARBFragmentProgram(mergeARBFragmentProgramRect, (sizeof(mergeARBFragmentProgramRect) / sizeof(mergeARBFragmentProgramRect[0])) - 1)
-                  : OpenGL::getARBFragmentProgram(mergeARBFragmentProgram2D, (sizeof(mergeARBFragmentProgram2D) / sizeof(mergeARBFragmentProgram2D[0])) - 1);
+            GLuint fId = getMergeARBFragmentProgram(isRectangularTexture());
             glBindProgramARB(GL_FRAGMENT_PROGRAM_ARB, fId);
             glEnable(GL_FRAGMENT_PROGRAM_ARB);
 
@@ -260,6 +276,7 @@ namespace OpenCSG {
                 scissor->enableScissor();
 
                 const std::vector<Primitive*> primitives = getPrimitives(*c);
+                OPENCSG_STATISTICS(stats->renderCalls[MergePhase] += static_cast<unsigned int>(primitives.size()));
                 for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
                     glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
                     RenderData* primitiveData = getRenderData(*j);
@@ -293,6 +310,8 @@ namespace OpenCSG {
         public:
             virtual Channel request();
             virtual void merge();
+        protected:
+            virtual bool refinesEdges() const { return true; }
         };
 
         Channel SCSChannelManagerGLSLProgram::request() {
@@ -312,9 +331,10 @@ namespace OpenCSG {
             "#version 110\n"
             "#extension GL_ARB_texture_rectangle : enable\n"
             "uniform sampler2DRect texture0;\n"
+            "uniform vec2 texOffset;\n"
             "uniform vec4 color;\n"
             "void main() {\n"
-            "    vec4 temp = texture2DRect(texture0, gl_FragCoord.xy);\n"
+            "    vec4 temp = texture2DRect(texture0, gl_FragCoord.xy - texOffset);\n"
             "    temp = temp - color;\n"
             "    if (dot(temp, temp) > 0.000001)\n"
             "        discard;\n"
@@ -325,36 +345,180 @@ namespace OpenCSG {
             "#version 110\n"
             "uniform sampler2D texture0;\n"
             "uniform vec2 texSizeInv;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec2 texelSize;\n"
             "uniform vec4 color;\n"
             "void main() {\n"
-            "    vec2 texCoord = vec2(gl_FragCoord.x * texSizeInv.x, gl_FragCoord.y * texSizeInv.y);\n"
+            "    vec2 texCoord = vec2((gl_FragCoord.x - texOffset.x) * texSizeInv.x, (gl_FragCoord.y - texOffset.y) * texSizeInv.y);\n"
             "    vec4 temp = texture2D(texture0, texCoord);\n"
+            "    if (texelSize.x > 0.0) {\n"
+            "        for (int y = -1; y <= 1; ++y) {\n"
+            "            for (int x = -1; x <= 1; ++x) {\n"
+            "                vec4 neighbor = texture2D(texture0, texCoord + vec2(float(x), float(y)) * texelSize) - temp;\n"
+            "                if (dot(neighbor, neighbor) > 0.000001)\n"
+            "                    discard;\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
             "    temp = temp - color;\n"
             "    if (dot(temp, temp) > 0.000001)\n"
             "        discard;\n"
             "    gl_FragColor = color;\n"
             "}\n";
 
-        void SCSChannelManagerGLSLProgram::merge()
+        // Same as above, for core profile contexts
+        static const char mergeFragmentProgramRectCore[] =
+            "#version 330 core\n"
+            "uniform sampler2DRect texture0;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec4 color;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec4 temp = texture(texture0, gl_FragCoord.xy - texOffset);\n"
+            "    temp = temp - color;\n"
+            "    if (dot(temp, temp) > 0.000001)\n"
+            "        discard;\n"
+            "    fragColor = color;\n"
+            "}\n";
+
+        static const char mergeFragmentProgram2DCore[] =
+            "#version 330 core\n"
+            "uniform sampler2D texture0;\n"
+            "uniform vec2 texSizeInv;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec2 texelSize;\n"
+            "uniform vec4 color;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec2 texCoord = (gl_FragCoord.xy - texOffset) * texSizeInv;\n"
+            "    vec4 temp = texture(texture0, texCoord);\n"
+            "    if (texelSize.x > 0.0) {\n"
+            "        for (int y = -1; y <= 1; ++y) {\n"
+            "            for (int x = -1; x <= 1; ++x) {\n"
+            "                vec4 neighbor = texture(texture0, texCoord + vec2(x, y) * texelSize) - temp;\n"
+            "                if (dot(neighbor, neighbor) > 0.000001)\n"
+            "                    discard;\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    temp = temp - color;\n"
+            "    if (dot(temp, temp) > 0.000001)\n"
+            "        discard;\n"
+            "    fragColor = color;\n"
+            "}\n";
+
+        // Same as above, with the ID computed by the default vertex shader
+        // for core profile contexts, see OpenGL::useIDProgram()
+        static const char mergeFragmentProgramRectCoreID[] =
+            "#version 330 core\n"
+            "uniform sampler2DRect texture0;\n"
+            "uniform vec2 texOffset;\n"
+            "flat in vec4 idColor;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec4 temp = texture(texture0, gl_FragCoord.xy - texOffset);\n"
+            "    temp = temp - idColor;\n"
+            "    if (dot(temp, temp) > 0.000001)\n"
+            "        discard;\n"
+            "    fragColor = idColor;\n"
+            "}\n";
+
+        static const char mergeFragmentProgram2DCoreID[] =
+            "#version 330 core\n"
+            "uniform sampler2D texture0;\n"
+            "uniform vec2 texSizeInv;\n"
+            "uniform vec2 texOffset;\n"
+            "uniform vec2 texelSize;\n"
+            "flat in vec4 idColor;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec2 texCoord = (gl_FragCoord.xy - texOffset) * texSizeInv;\n"
+            "    vec4 temp = texture(texture0, texCoord);\n"
+            "    if (texelSize.x > 0.0) {\n"
+            "        for (int y = -1; y <= 1; ++y) {\n"
+            "            for (int x = -1; x <= 1; ++x) {\n"
+            "                vec4 neighbor = texture(texture0, texCoord + vec2(x, y) * texelSize) - temp;\n"
+            "                if (dot(neighbor, neighbor) > 0.000001)\n"
+            "                    discard;\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    temp = temp - idColor;\n"
+            "    if (dot(temp, temp) > 0.000001)\n"
+            "        discard;\n"
+            "    fragColor = idColor;\n"
+            "}\n";
+
+        // returns 0 if not waiting for the program, which is still built
+        // in the background
+        GLuint getMergeProgram(bool rectangular, bool wait = true)
         {
             const int SCSIdOffset = 2;
-            const char* programID = getVertexShader() + (isRectangularTexture() ? 1 : 0) + SCSIdOffset;
-            GLuint glslProgram =
-                isRectangularTexture()
-                    ? OpenGL::getGLSLProgram(programID, getVertexShader(), mergeFragmentProgramRect)
-                    : OpenGL::getGLSLProgram(programID, getVertexShader(), mergeFragmentProgram2D);
+            const int SCSIdOffsetID = 6;
+            const char* vertexShader = OpenGL::mergeVertexShader();
+            if (OpenGL::hasIDProgram()) {
+                const char* programID = vertexShader + (rectangular ? 1 : 0) + SCSIdOffsetID;
+                const char* fragmentShader = rectangular ? mergeFragmentProgramRectCoreID : mergeFragmentProgram2DCoreID;
+                return OpenGL::getGLSLProgram(programID, vertexShader, fragmentShader, wait);
+            }
+            const char* programID = vertexShader + (rectangular ? 1 : 0) + SCSIdOffset;
+            const char* fragmentShader =
+                OpenGL::coreProfile
+                    ? (rectangular ? mergeFragmentProgramRectCore : mergeFragmentProgram2DCore)
+                    : (rectangular ? mergeFragmentProgramRect : mergeFragmentProgram2D);
+            return OpenGL::getGLSLProgram(programID, vertexShader, fragmentShader, wait);
+        }
 
-            GLint col = glGetUniformLocation(glslProgram, "color");
-            GLint texSizeInv = -1;
-            if (!isRectangularTexture())
-                texSizeInv = glGetUniformLocation(glslProgram, "texSizeInv");
+        bool lessID(Primitive* a, Primitive* b) {
+            return getRenderData(a)->bufferId.value() < getRenderData(b)->bufferId.value();
+        }
+
+        // merges the primitives with the merge program computing the IDs in
+        // the vertex shader. Sorted by their IDs, the intersected primitives
+        // and each batch of the subtracted primitives are drawn together
+        void mergeIDs(std::vector<Primitive*> primitives) {
+            std::sort(primitives.begin(), primitives.end(), lessID);
+
+            std::vector<Primitive*> intersected;
+            std::vector<Primitive*> subtracted;
+            std::vector<GLuint> intersectedIds;
+            std::vector<GLuint> subtractedIds;
+            for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
+                const GLuint id = getRenderData(*j)->bufferId.value();
+                if ((*j)->getOperation() == Intersection) {
+                    intersected.push_back(*j);
+                    intersectedIds.push_back(id);
+                } else {
+                    subtracted.push_back(*j);
+                    subtractedIds.push_back(id);
+                }
+            }
 
-            glUseProgram(glslProgram);
+            if (!intersected.empty()) {
+                glCullFace(GL_BACK);
+                OpenGL::renderBatch(intersected, &intersectedIds[0]);
+            }
+            if (!subtracted.empty()) {
+                glCullFace(GL_FRONT);
+                OpenGL::renderBatch(subtracted, &subtractedIds[0]);
+            }
+        }
+
+        void SCSChannelManagerGLSLProgram::merge()
+        {
+            GLuint glslProgram = getMergeProgram(isRectangularTexture());
+
+            // the rectangular texture programs have no texSizeInv
+            const OpenGL::ProgramUniforms& uniforms = OpenGL::getGLSLProgramUniforms(glslProgram);
+            GLint col = uniforms.color;
+
+            OpenGL::useProgram(glslProgram);
 
             ProjTextureSetup setup = GLSLProgram;
-            setupProjectiveTexture(setup, texSizeInv);
+            setupProjectiveTexture(setup, uniforms.texSizeInv, uniforms.texOffset, uniforms.texelSize);
 
-            glDisable(GL_ALPHA_TEST);
+            if (!OpenGL::coreProfile)
+                glDisable(GL_ALPHA_TEST);
             glEnable(GL_CULL_FACE);
             glEnable(GL_DEPTH_TEST);
             glDepthFunc(GL_LESS);
@@ -369,6 +533,11 @@ namespace OpenCSG {
                 scissor->enableScissor();
 
                 const std::vector<Primitive*> primitives = getPrimitives(*c);
+                if (OpenGL::hasIDProgram()) {
+                    mergeIDs(primitives);
+                    continue;
+                }
+                OPENCSG_STATISTICS(stats->renderCalls[MergePhase] += static_cast<unsigned int>(primitives.size()));
                 for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
                     glCullFace((*j)->getOperation() == Intersection ? GL_BACK : GL_FRONT);
                     RenderData* primitiveData = getRenderData(*j);
@@ -385,7 +554,7 @@ namespace OpenCSG {
 
             glDisable(GL_CULL_FACE);
             glDepthFunc(GL_LEQUAL);
-            glUseProgram(0);
+            OpenGL::resetProgram();
 
             resetProjectiveTexture(setup);
 
@@ -395,9 +564,19 @@ namespace OpenCSG {
 
         ChannelManagerForBatches* getChannelManager() {
 
+            // Only GLSL is available in core profile contexts
+            OpenGL::coreProfile = OpenGL::isCoreProfile();
+            if (OpenGL::coreProfile)
+                return new SCSChannelManagerGLSLProgram;
+
             if (GLAD_GL_VERSION_2_0)
             {
-                bool useGLSL = getVertexShader() != 0;
+                // while the merge program for the vertex shader is still
+                // built in the background, merge with the paths below.
+                // Without a vertex shader, the GLSL program is only needed
+                // for refining the edges at reduced resolution.
+                bool useGLSL =    (getVertexShader() != 0 || Refinement::divisor > 1)
+                               && getMergeProgram(OpenGL::getCapabilities().rectangularOffscreenBuffers, false) != 0;
                 if (useGLSL)
                     return new SCSChannelManagerGLSLProgram;
             }
@@ -410,12 +589,7 @@ namespace OpenCSG {
             if (   OPENCSG_HAS_EXT(ARB_vertex_program)
                 && OPENCSG_HAS_EXT(ARB_fragment_program)
             ) {
-                std::string vendor;
-                if (const char * v = (const char*)glGetString(GL_VENDOR))
-                    vendor = v;
-                bool isIntel = vendor.find("Intel") == 0;
-
-                ProjTextureSetup setup = isIntel ? ARBShader : FixedFunction;
+                ProjTextureSetup setup = OpenGL::getCapabilities().intel ? ARBShader : FixedFunction;
                 return new SCSChannelManagerARBProgram(setup);
             }
 
@@ -445,12 +619,45 @@ namespace OpenCSG {
             unsigned int counter;
         };
 
-        ChannelManagerForBatches* channelMgr;
+        thread_local ChannelManagerForBatches* channelMgr;
+
+        // renders the primitives with their IDs as color. If the vertex
+        // shader can compute the IDs, primitives with consecutive IDs are
+        // drawn together by renderBatch(), which is why the IDs are assigned
+        // to the intersected primitives and to each batch in turn. Else, or
+        // in a compatibility context, each primitive is drawn on its own
+        void renderIDs(const std::vector<Primitive*>& primitives) {
+            if (primitives.empty())
+                return;
+
+            if (OpenGL::hasIDProgram()) {
+                std::vector<GLuint> ids;
+                ids.reserve(primitives.size());
+                for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
+                    ids.push_back(getRenderData(*j)->bufferId.value());
+                }
+                OpenGL::useIDProgram();
+                OpenGL::renderBatch(primitives, &ids[0]);
+                OpenGL::resetProgram();
+                return;
+            }
+
+            OPENCSG_STATISTICS(stats->renderCalls[Stats::phase] += static_cast<unsigned int>(primitives.size()));
+            for (std::vector<Primitive*>::const_iterator j = primitives.begin(); j != primitives.end(); ++j) {
+                RenderData * primitiveData = getRenderData(*j);
+                GLubyte * id = primitiveData->bufferId.vec();
+                OpenGL::color4ubv(id);
+                (*j)->render();
+            }
+        }
 
         void renderIntersectedFront(const std::vector<Primitive*>& primitives) {
 
             const std::size_t numberOfPrimitives = primitives.size();
 
+            OPENCSG_TRACE_SCOPE("SCS.intersect.front", -1);
+            OPENCSG_STATISTICS_PHASE(IntersectionPhase);
+
             glDepthMask(GL_TRUE);
 
             // optimization for only one shape
@@ -459,10 +666,7 @@ namespace OpenCSG {
                 glDepthFunc(GL_GREATER);
                 glCullFace(GL_BACK);
                 glEnable(GL_CULL_FACE);
-                RenderData * primitiveData = getRenderData(primitives[0]);
-                GLubyte * id = primitiveData->bufferId.vec();
-                glColor4ubv(id);
-                primitives[0]->render();
+                renderIDs(primitives);
                 glDisable(GL_CULL_FACE);
                 glDepthFunc(GL_LESS);
 
@@ -476,14 +680,7 @@ namespace OpenCSG {
             glCullFace(GL_BACK);
             glEnable(GL_CULL_FACE);
 
-            {
-                for (std::vector<Primitive*>::const_iterator i = primitives.begin(); i != primitives.end(); ++i) {
-                    RenderData * primitiveData = getRenderData(*i);
-                    GLubyte * id = primitiveData->bufferId.vec();
-                    glColor4ubv(id);
-                    (*i)->render();
-                }
-            }
+            renderIDs(primitives);
 
             // count back faces behind furthest front face
             channelMgr->renderToChannel(false);
@@ -493,11 +690,7 @@ namespace OpenCSG {
             glDepthMask(GL_FALSE);
             glCullFace(GL_FRONT);
 
-            {
-                for (std::vector<Primitive*>::const_iterator i = primitives.begin(); i != primitives.end(); ++i) {
-                    (*i)->render();
-                }
-            }
+            OpenGL::renderBatch(primitives);
 
             // where #back faces behind furthest front face != #intersected shapes
             // ->reset fragment
@@ -508,7 +701,7 @@ namespace OpenCSG {
             glDepthMask(GL_TRUE);
             glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
             glDisable(GL_CULL_FACE);
-            glColor4ub(0, 0, 0, 0);
+            OpenGL::color4ub(0, 0, 0, 0);
 
             OpenGL::drawQuad();
 
@@ -517,12 +710,22 @@ namespace OpenCSG {
             glDisable(GL_STENCIL_TEST);
         }
 
+        // in renderProgressive(), the subtraction resumes where the last call
+        // stopped. Step 0 renders the intersected primitives, step i + 1 the
+        // iteration i of the subtraction sequence.
+        size_t firstIteration() {
+            return Progressive::current ? Progressive::firstStep() - 1 : 0;
+        }
+
         void subtractPrimitives(const std::vector<Batch>& batches,
                                 const unsigned int depthComplexity = 0) {
 
             int setting = getOption(CameraOutsideOptimization);
             bool cameraInsideModel = (setting == OptimizationOff);
 
+            OPENCSG_TRACE_SCOPE("SCS.subtract", -1);
+            OPENCSG_STATISTICS_PHASE(SubtractionPhase);
+
             glStencilMask(OpenGL::stencilMask);
             glEnable(GL_STENCIL_TEST);
             glEnable(GL_CULL_FACE);
@@ -543,15 +746,26 @@ namespace OpenCSG {
                 numIterations = sequencer->sizeForDepthComplexity(depthComplexity);
             }
 
-            unsigned int stencilref = 0;
-            for (size_t i = 0; i < numIterations; ++i)
+            unsigned int localStencilRef = 0;
+            unsigned int& stencilref = Progressive::current ? Progressive::current->stencilRef : localStencilRef;
+            for (size_t i = firstIteration(); i < numIterations; ++i)
             {
-                const Batch& batch = batches[sequencer->index(i)];
+                if (!Progressive::proceed()) {
+                    glDisable(GL_STENCIL_TEST);
+                    return;
+                }
+
+                const size_t idx = sequencer->index(i);
+                const Batch& batch = batches[idx];
+
+                OPENCSG_TRACE_SCOPE("SCS.subtract.iteration", static_cast<int>(idx));
+                OPENCSG_STATISTICS(++stats->sequenceIterations);
 
                 // create a distinct reference value
                 ++stencilref;
                 if (stencilref == OpenGL::stencilMax) {
                     glClear(GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
                     stencilref = 1;
                 }
 
@@ -566,9 +780,7 @@ namespace OpenCSG {
                     glDepthFunc(GL_GREATER);
                     glCullFace(GL_FRONT);
 
-                    for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                        (*j)->render();
-                    }
+                    OpenGL::renderBatch(batch);
 
                     glStencilFunc(GL_EQUAL, stencilref, OpenGL::stencilMask);
                     glStencilOp(GL_ZERO, GL_ZERO, GL_KEEP);
@@ -577,11 +789,7 @@ namespace OpenCSG {
                 glDepthFunc(GL_LESS);
                 glCullFace(GL_BACK);
 
-                {
-                    for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                        (*j)->render();
-                    }
-                }
+                OpenGL::renderBatch(batch);
 
                 // where front faces have been visible, render back faces
                 channelMgr->renderToChannel(true);
@@ -591,16 +799,11 @@ namespace OpenCSG {
                 glStencilFunc(GL_EQUAL, stencilref, OpenGL::stencilMask);
                 glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
 
-                {
-                    for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                        RenderData * primitiveData = getRenderData(*j);
-                        GLubyte * id = primitiveData->bufferId.vec();
-                        glColor4ubv(id);
-                        (*j)->render();
-                    }
-                }
+                renderIDs(batch);
             }
 
+            Progressive::finish();
+
             glDisable(GL_STENCIL_TEST);
         }
 
@@ -616,27 +819,43 @@ namespace OpenCSG {
             int setting = getOption(CameraOutsideOptimization);
             bool cameraInsideModel = (setting == OptimizationOff);
 
+            OPENCSG_TRACE_SCOPE("SCS.subtract", -1);
+            OPENCSG_STATISTICS_PHASE(SubtractionPhase);
+
             glStencilMask(OpenGL::stencilMask);
             glEnable(GL_STENCIL_TEST);
             glEnable(GL_CULL_FACE);
 
-            std::vector<unsigned int> fragmentcount(numberOfBatches, 0);
-            unsigned int shapesWithoutUpdate = 0;
+            std::vector<unsigned int> localFragmentCount;
+            unsigned int localShapesWithoutUpdate = 0;
+            unsigned int localStencilRef = 0;
+            std::vector<unsigned int>& fragmentcount = Progressive::current ? Progressive::current->fragmentCount : localFragmentCount;
+            unsigned int& shapesWithoutUpdate = Progressive::current ? Progressive::current->shapesWithoutUpdate : localShapesWithoutUpdate;
+            unsigned int& stencilref = Progressive::current ? Progressive::current->stencilRef : localStencilRef;
+            fragmentcount.resize(numberOfBatches, 0);
 
             SimpleSequencer sequencer(numberOfBatches);
             size_t numIterations = sequencer.size();
 
-            unsigned int stencilref = 0;
-
-            for (size_t i = 0; i < numIterations; ++i)
+            bool stopped = false;
+            for (size_t i = firstIteration(); i < numIterations; ++i)
             {
+                if (!Progressive::proceed()) {
+                    stopped = true;
+                    break;
+                }
+
                 size_t idx = sequencer.index(i);
                 const Batch& batch = batches[idx];
 
+                OPENCSG_TRACE_SCOPE("SCS.subtract.iteration", static_cast<int>(idx));
+                OPENCSG_STATISTICS(++stats->sequenceIterations);
+
                 // create a distinct reference value
                 ++stencilref;
                 if (stencilref == OpenGL::stencilMax) {
                     glClear(GL_STENCIL_BUFFER_BIT);
+                    OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
                     stencilref = 1;
                 }
 
@@ -652,11 +871,7 @@ namespace OpenCSG {
                     glDepthFunc(GL_GREATER);
                     glCullFace(GL_FRONT);
 
-                    {
-                        for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                            (*j)->render();
-                        }
-                    }
+                    OpenGL::renderBatch(batch);
 
                     glStencilFunc(GL_EQUAL, stencilref, OpenGL::stencilMask);
                     glStencilOp(GL_ZERO, GL_ZERO, GL_KEEP);
@@ -665,11 +880,7 @@ namespace OpenCSG {
                 glDepthFunc(GL_LESS);
                 glCullFace(GL_BACK);
 
-                {
-                    for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                        (*j)->render();
-                    }
-                }
+                OpenGL::renderBatch(batch);
                 occlusionTest->endQuery();
                 // the fragment count query could occur here, but benches show that
                 // the algorithm is faster if the query is delayed.
@@ -681,16 +892,10 @@ namespace OpenCSG {
                 glStencilFunc(GL_EQUAL, stencilref, OpenGL::stencilMask);
                 glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
 
-                {
-                    for (Batch::const_iterator j = batch.begin(); j != batch.end(); ++j) {
-                        RenderData * primitiveData = getRenderData(*j);
-                        GLubyte * id = primitiveData->bufferId.vec();
-                        glColor4ubv(id);
-                        (*j)->render();
-                    }
-                }
+                renderIDs(batch);
 
                 unsigned int newFragmentCount = occlusionTest->getQueryResult();
+                OPENCSG_STATISTICS(++stats->occlusionQueries; stats->occlusionQuerySamples += newFragmentCount);
                 if (newFragmentCount != fragmentcount[idx]) {
                     fragmentcount[idx] = newFragmentCount;
                     shapesWithoutUpdate = 0;
@@ -701,6 +906,9 @@ namespace OpenCSG {
                 }
             }
 
+            if (!stopped)
+                Progressive::finish();
+
             delete occlusionTest;
 
             glDisable(GL_STENCIL_TEST);
@@ -712,26 +920,79 @@ namespace OpenCSG {
             // where a back face of intersected shape is in front of any subtracted shape
             // mask fragment as invisible. Updating depth values is not necessary, so when
             // having IDs, this is kind of simple.
+            OPENCSG_TRACE_SCOPE("SCS.intersect.back", -1);
+            OPENCSG_STATISTICS_PHASE(IntersectionPhase);
             channelMgr->renderToChannel(true);
             glEnable(GL_CULL_FACE);
             glCullFace(GL_FRONT);
             glDepthMask(GL_FALSE);
             glDepthFunc(GL_LESS);
-            glColor4ub(0, 0, 0, 0);
+            OpenGL::color4ub(0, 0, 0, 0);
 
-            for (std::vector<Primitive*>::const_iterator i = primitives.begin(); i != primitives.end(); ++i) {
-                (*i)->render();
-            }
+            OpenGL::renderBatch(primitives);
 
             glDepthMask(GL_TRUE);
         }
 
+        void resolveSharedDepth(const std::vector<Primitive*>& primitives) {
+            // the depth buffer is the one of the application, so instead of
+            // masking the IDs and merging, reset the depth to the far plane
+            // where a back face of an intersected shape is in front of the
+            // depth found, or where no depth has been found at all (i.e., the
+            // depth is still at the near plane, to which it has been cleared).
+            // Both is marked in the stencil buffer first.
+            OPENCSG_TRACE_SCOPE("SCS.intersect.back", -1);
+            OPENCSG_STATISTICS_PHASE(IntersectionPhase);
+            channelMgr->renderToChannel(false);
+            glStencilMask(OpenGL::stencilMask);
+            glClear(GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
+            glEnable(GL_STENCIL_TEST);
+            glStencilFunc(GL_ALWAYS, 1, OpenGL::stencilMask);
+            glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+            glDepthMask(GL_FALSE);
+
+            glEnable(GL_CULL_FACE);
+            glCullFace(GL_FRONT);
+            glDepthFunc(GL_LESS);
+            OpenGL::renderBatch(primitives);
+            glDisable(GL_CULL_FACE);
+
+            glDepthFunc(GL_EQUAL);
+            glDepthRange(0.0, 0.0);
+            OpenGL::drawQuad();
+
+            glStencilFunc(GL_EQUAL, 1, OpenGL::stencilMask);
+            glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+            glDepthFunc(GL_ALWAYS);
+            glDepthRange(1.0, 1.0);
+            glDepthMask(GL_TRUE);
+            OpenGL::drawQuad();
+
+            glDepthRange(0.0, 1.0);
+            glDepthFunc(GL_LESS);
+            glDisable(GL_STENCIL_TEST);
+        }
+
     } // unnamed namespace
 
     void renderSCS(const std::vector<Primitive*>& primitives, DepthComplexityAlgorithm algorithm) {
 
+        OPENCSG_TRACE_SCOPE("SCS.render", -1);
+
         channelMgr = getChannelManager();
-        if (!channelMgr->init())
+        // with the SharedDepthStencilSetting, the CSG result is rendered
+        // into the depth buffer of the application directly
+        OpenGL::OffscreenBuffer* sharedBuffer = Progressive::current ? 0 : OpenGL::getSharedDepthStencilBuffer();
+        if (sharedBuffer && !channelMgr->init(sharedBuffer))
+        {
+            // the depth / stencil buffer cannot be attached after all
+            delete channelMgr;
+            channelMgr = getChannelManager();
+            sharedBuffer = 0;
+        }
+        // renderProgressive() keeps the depth and ID buffers between the calls
+        if (!sharedBuffer && !channelMgr->init(Progressive::getOffscreenBuffer()))
         {
             delete channelMgr;
             return;
@@ -744,35 +1005,52 @@ namespace OpenCSG {
         std::vector<Primitive*> intersected; intersected.reserve(primitives.size());
         std::vector<Primitive*> subtracted;  subtracted.reserve(primitives.size());
 
+        for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
+            Operation operation= (*itr)->getOperation();
+            if (operation == Intersection) {
+                intersected.push_back(*itr);
+            } else if (operation == Subtraction) {
+                subtracted.push_back(*itr);
+            }
+        }
+
+        Batcher subtractedBatches(subtracted);
+        OPENCSG_STATISTICS(stats->batches += static_cast<unsigned int>(subtractedBatches.size()));
+
+        // consecutive IDs for the intersected primitives and within each
+        // batch, such that renderIDs() can draw them together
         {
             IDGenerator IDMaker;
-            for (std::vector<Primitive*>::const_iterator itr = primitives.begin(); itr != primitives.end(); ++itr) {
-                {
+            for (std::vector<Primitive*>::const_iterator itr = intersected.begin(); itr != intersected.end(); ++itr) {
+                RenderData dta; 
+                dta.bufferId = IDMaker.newID();
+                gRenderInfo.insert(std::make_pair(*itr, dta));
+            }
+            const std::vector<Batch>& batches = subtractedBatches.batches();
+            for (std::vector<Batch>::const_iterator b = batches.begin(); b != batches.end(); ++b) {
+                for (Batch::const_iterator itr = b->begin(); itr != b->end(); ++itr) {
                     RenderData dta; 
                     dta.bufferId = IDMaker.newID();
                     gRenderInfo.insert(std::make_pair(*itr, dta));
                 }
-                Operation operation= (*itr)->getOperation();
-                if (operation == Intersection) {
-                    intersected.push_back(*itr);
-                } else if (operation == Subtraction) {
-                    subtracted.push_back(*itr);
-                }
             }
         }
 
-        Batcher subtractedBatches(subtracted);
-
         scissor->setIntersected(intersected);
         scissor->setCurrent(intersected);
 
         unsigned int depthComplexity = 0;
-        if (algorithm == DepthComplexitySampling) {
+        if (algorithm == DepthComplexitySampling && Progressive::current && Progressive::current->depthComplexity >= 0) {
+            depthComplexity = static_cast<unsigned int>(Progressive::current->depthComplexity);
+        } else if (algorithm == DepthComplexitySampling) {
             scissor->enableScissor();
             glClear(GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_STENCIL_BUFFER_BIT));
             depthComplexity =
                 (std::min)(OpenGL::calcMaxDepthComplexity(subtracted, scissor->getCurrentArea()),
                            static_cast<unsigned int>(subtractedBatches.size()));
+            if (Progressive::current)
+                Progressive::current->depthComplexity = static_cast<int>(depthComplexity);
         }
 
         channelMgr->request();
@@ -781,15 +1059,24 @@ namespace OpenCSG {
         scissor->enableScissor();
         scissor->store(channelMgr->current());
 
-        glDepthMask(GL_TRUE);
-        glStencilMask(OpenGL::stencilMask);
-        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-        glClearDepth(0.0);      // near clipping plane! essential for algorithm!
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-        glClearDepth(1.0);
+        // step 0. In later calls of renderProgressive(), the offscreen
+        // buffer still holds the result of the steps rendered so far.
+        if (Progressive::firstStep() == 0 && Progressive::proceed()) {
+            glDepthMask(GL_TRUE);
+            glStencilMask(OpenGL::stencilMask);
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+            glClearDepth(0.0);      // near clipping plane! essential for algorithm!
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            OPENCSG_STATISTICS(Stats::countClear(stats, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
+            glClearDepth(1.0);
 
-        renderIntersectedFront(intersected);
-        if (!subtractedBatches.batches().empty())
+            renderIntersectedFront(intersected);
+        }
+        if (subtractedBatches.batches().empty())
+        {
+            Progressive::finish();
+        }
+        else if (!Progressive::current || !Progressive::current->converged)
         {
             scissor->enableDepthBounds();
             switch (algorithm) {
@@ -807,15 +1094,43 @@ namespace OpenCSG {
             }
             scissor->disableDepthBounds();
         }
-        renderIntersectedBack(intersected);
+        if (sharedBuffer)
+            resolveSharedDepth(intersected);
+        else
+            renderIntersectedBack(intersected);
 
         scissor->disableScissor();
 
-        channelMgr->store(channelMgr->current(), primitives, 0);
-        channelMgr->free();
+        if (sharedBuffer) {
+            channelMgr->discard();
+        } else {
+            channelMgr->store(channelMgr->current(), primitives, 0);
+            channelMgr->free();
+        }
 
         delete scissor;
         delete channelMgr;
     }
 
+    void warmUpSCS(bool rectangular) {
+        // the same choice of the merge programs as in getChannelManager()
+        const bool glsl = OpenGL::coreProfile || (GLAD_GL_VERSION_2_0 && getVertexShader());
+        if (glsl || (GLAD_GL_VERSION_2_0 && getOption(ResolutionSetting) != FullResolution)) {
+            getMergeProgram(false, false);
+            if (rectangular)
+                getMergeProgram(true, false);
+        }
+        if (   !glsl
+            && OPENCSG_HAS_EXT(ARB_vertex_program)
+            && OPENCSG_HAS_EXT(ARB_fragment_program)
+        ) {
+            OpenGL::getARBVertexProgram(mergeARBVertexProgram, (sizeof(mergeARBVertexProgram) / sizeof(mergeARBVertexProgram[0])) - 1);
+            getMergeARBFragmentProgram(false);
+            if (rectangular)
+                getMergeARBFragmentProgram(true);
+            glBindProgramARB(GL_VERTEX_PROGRAM_ARB, 0);
+            glBindProgramARB(GL_FRAGMENT_PROGRAM_ARB, 0);
+        }
+    }
+
 } // namespace OpenCSG
@@ -21,78 +21,121 @@
 
 #include "opencsgConfig.h"
 #include <opencsg.h>
+#include "settings.h"
 
 #include <algorithm>
-#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 namespace OpenCSG {
 
-    // Stores constant strings of all vertex shaders that were ever provided to OpenCSG.
-    // This would compile with std::set as well. But I expect very few shaders here, only.
-    // Note that std::vector would be incorrect, because when resizing the vector,
-    // the strings could be relocated. This must not happen, because the string pointers
-    // are used as keys for the actual GLSL program IDs.
-    typedef std::list<std::string> VertexShaders;
+    // Stores constant strings of all vertex shaders that were ever provided to OpenCSG,
+    // hashed by their content. The elements of an unordered set are not relocated when
+    // it is rehashed. This is essential, because the string pointers are used as keys
+    // for the actual GLSL program IDs.
+    // The strings are shared by all threads, since the program IDs of a
+    // context may be requested by another thread later; each thread
+    // selects its own current shader, though.
+    typedef std::unordered_set<std::string> VertexShaders;
 
     static VertexShaders gVertexShaders;
-    static VertexShaders::iterator gCurrentVertexShader = gVertexShaders.end();
+    static std::mutex gVertexShadersMutex;
+    static thread_local const std::string* gCurrentVertexShader = 0;
 
     void setVertexShader(const std::string& vertexShader)
     {
         if (vertexShader.length() == 0)
         {
-            gCurrentVertexShader = gVertexShaders.end();
+            gCurrentVertexShader = 0;
             return;
         }
 
-        if (gCurrentVertexShader != gVertexShaders.end() && *gCurrentVertexShader == vertexShader)
+        if (gCurrentVertexShader && *gCurrentVertexShader == vertexShader)
             return;
 
-        VertexShaders::iterator it = std::find(gVertexShaders.begin(), gVertexShaders.end(), vertexShader);
-        if (it != gVertexShaders.end())
-        {
-            gCurrentVertexShader = it;
-            return;
-        }
-
-        gCurrentVertexShader = gVertexShaders.insert(it, vertexShader);
+        std::lock_guard<std::mutex> lock(gVertexShadersMutex);
+        gCurrentVertexShader = &*gVertexShaders.insert(vertexShader).first;
     }
 
     const char* getVertexShader()
     {
-        if (gCurrentVertexShader == gVertexShaders.end())
+        if (!gCurrentVertexShader)
             return 0;
 
         return gCurrentVertexShader->c_str();
     }
 
-    static int* gSetting = 0;
+    // Matrices for rendering in a core profile context. Identity by default.
+    static thread_local float gModelview[16]  = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                                  0.0f, 1.0f, 0.0f, 0.0f,
+                                                  0.0f, 0.0f, 1.0f, 0.0f,
+                                                  0.0f, 0.0f, 0.0f, 1.0f };
+    static thread_local float gProjection[16] = { 1.0f, 0.0f, 0.0f, 0.0f,
+                                                  0.0f, 1.0f, 0.0f, 0.0f,
+                                                  0.0f, 0.0f, 1.0f, 0.0f,
+                                                  0.0f, 0.0f, 0.0f, 1.0f };
+
+    void setMatrices(const float modelview[16], const float projection[16])
+    {
+        std::copy(modelview, modelview + 16, gModelview);
+        std::copy(projection, projection + 16, gProjection);
+    }
 
-    static void initIntOptions() {
-        if (!gSetting) {
-            gSetting = new int[OptionTypeUnused];
-            for (int i=0; i<OptionTypeUnused; ++i) {
-                gSetting[i] = 0;
-            }
-        }
+    void getMatrices(float modelview[16], float projection[16])
+    {
+        std::copy(gModelview, gModelview + 16, modelview);
+        std::copy(gProjection, gProjection + 16, projection);
     }
 
+    // The options are shared by all threads, like in a single-threaded
+    // application, all 0 by default. A thread may override them for
+    // itself with setThreadOption(); render() does so temporarily for
+    // the settings it chooses automatically.
+    static int gSetting[OptionTypeUnused];
+    static std::mutex gSettingMutex;
+    static thread_local ThreadOption gThreadSetting[OptionTypeUnused];
+
     void setOption(OptionType option, int newSetting) {
         if ((unsigned int)option < OptionTypeUnused) {
-            initIntOptions();
+            std::lock_guard<std::mutex> lock(gSettingMutex);
             gSetting[option] = newSetting;
         }
     }
 
     int getOption(OptionType option) {
-        initIntOptions();
         if ((unsigned int)option < OptionTypeUnused) {
+            if (gThreadSetting[option].overridden)
+                return gThreadSetting[option].setting;
+            std::lock_guard<std::mutex> lock(gSettingMutex);
             return gSetting[option];
         }
 
         return 0;
     }
 
+    void setThreadOption(OptionType option, int newSetting) {
+        if ((unsigned int)option < OptionTypeUnused) {
+            gThreadSetting[option].overridden = true;
+            gThreadSetting[option].setting = newSetting;
+        }
+    }
+
+    void resetThreadOptions() {
+        std::fill(gThreadSetting, gThreadSetting + OptionTypeUnused, ThreadOption());
+    }
+
+    ThreadOption getThreadOption(OptionType option) {
+        if ((unsigned int)option < OptionTypeUnused)
+            return gThreadSetting[option];
+
+        return ThreadOption();
+    }
+
+    void restoreThreadOption(OptionType option, const ThreadOption& threadOption) {
+        if ((unsigned int)option < OptionTypeUnused)
+            gThreadSetting[option] = threadOption;
+    }
+
 } // namespace OpenCSG
@@ -35,10 +35,30 @@ namespace OpenCSG {
     void setVertexShader(const std::string& vertexShader);
     const char* getVertexShader();
 
+    /// redeclared from opencsg.h
+    void setMatrices(const float modelview[16], const float projection[16]);
+    /// returns the matrices set with setMatrices()
+    void getMatrices(float modelview[16], float projection[16]);
+
     /// redeclared from opencsg.h
     void setOption(OptionType option, int newSetting);
     /// redeclared from opencsg.h
     int  getOption(OptionType option);
+    /// redeclared from opencsg.h
+    void setThreadOption(OptionType option, int newSetting);
+    /// redeclared from opencsg.h
+    void resetThreadOptions();
+
+    /// an option overridden by the calling thread, if overridden is true
+    struct ThreadOption {
+        ThreadOption() : overridden(false), setting(0) { }
+        bool overridden;
+        int setting;
+    };
+    /// returns the override of the option by the calling thread
+    ThreadOption getThreadOption(OptionType option);
+    /// restores an override returned by getThreadOption()
+    void restoreThreadOption(OptionType option, const ThreadOption& threadOption);
 
 } // namespace OpenCSG
 
@@ -0,0 +1,139 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// stateMemo.cpp
+//
+
+#include "opencsgConfig.h"
+#include "stateMemo.h"
+#include "openglHelper.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        StateMemo::StateMemo() {
+            mDepthTest   = glIsEnabled(GL_DEPTH_TEST);
+            mStencilTest = glIsEnabled(GL_STENCIL_TEST);
+            mCullFace    = glIsEnabled(GL_CULL_FACE);
+            mScissorTest = glIsEnabled(GL_SCISSOR_TEST);
+            mBlend       = glIsEnabled(GL_BLEND);
+            mDepthBoundsTest = OPENCSG_HAS_EXT(EXT_depth_bounds_test) ? glIsEnabled(GL_DEPTH_BOUNDS_TEST_EXT) : GL_FALSE;
+
+            glGetBooleanv(GL_COLOR_WRITEMASK, mColorMask);
+            glGetBooleanv(GL_DEPTH_WRITEMASK, &mDepthMask);
+            glGetIntegerv(GL_DEPTH_FUNC, &mDepthFunc);
+            glGetDoublev(GL_DEPTH_RANGE, mDepthRange);
+            glGetIntegerv(GL_CULL_FACE_MODE, &mCullFaceMode);
+
+            glGetIntegerv(GL_STENCIL_FUNC, &mStencilFunc[0]);
+            glGetIntegerv(GL_STENCIL_REF, &mStencilRef[0]);
+            glGetIntegerv(GL_STENCIL_VALUE_MASK, &mStencilValueMask[0]);
+            glGetIntegerv(GL_STENCIL_WRITEMASK, &mStencilWriteMask[0]);
+            glGetIntegerv(GL_STENCIL_FAIL, &mStencilFail[0]);
+            glGetIntegerv(GL_STENCIL_PASS_DEPTH_FAIL, &mStencilPassDepthFail[0]);
+            glGetIntegerv(GL_STENCIL_PASS_DEPTH_PASS, &mStencilPassDepthPass[0]);
+            glGetIntegerv(GL_STENCIL_BACK_FUNC, &mStencilFunc[1]);
+            glGetIntegerv(GL_STENCIL_BACK_REF, &mStencilRef[1]);
+            glGetIntegerv(GL_STENCIL_BACK_VALUE_MASK, &mStencilValueMask[1]);
+            glGetIntegerv(GL_STENCIL_BACK_WRITEMASK, &mStencilWriteMask[1]);
+            glGetIntegerv(GL_STENCIL_BACK_FAIL, &mStencilFail[1]);
+            glGetIntegerv(GL_STENCIL_BACK_PASS_DEPTH_FAIL, &mStencilPassDepthFail[1]);
+            glGetIntegerv(GL_STENCIL_BACK_PASS_DEPTH_PASS, &mStencilPassDepthPass[1]);
+
+            glGetFloatv(GL_COLOR_CLEAR_VALUE, mClearColor);
+            glGetDoublev(GL_DEPTH_CLEAR_VALUE, &mClearDepth);
+            glGetIntegerv(GL_STENCIL_CLEAR_VALUE, &mClearStencil);
+
+            glGetIntegerv(GL_VIEWPORT, mViewport);
+            glGetIntegerv(GL_SCISSOR_BOX, mScissorBox);
+            if (OPENCSG_HAS_EXT(EXT_depth_bounds_test))
+                glGetDoublev(GL_DEPTH_BOUNDS_EXT, mDepthBounds);
+
+            glGetIntegerv(GL_CURRENT_PROGRAM, &mProgram);
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &mVertexArray);
+            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &mArrayBuffer);
+            // OpenCSG only uses texture unit 0, which stays active until restore()
+            glGetIntegerv(GL_ACTIVE_TEXTURE, &mActiveTexture);
+            glActiveTexture(GL_TEXTURE0);
+            glGetIntegerv(GL_TEXTURE_BINDING_2D, &mTexture2D);
+            glGetIntegerv(GL_TEXTURE_BINDING_RECTANGLE, &mTextureRectangle);
+            glGetIntegerv(GL_UNIFORM_BUFFER_BINDING, &mUniformBuffer);
+            glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, matrixUniformBufferBinding, &mMatrixBuffer);
+            glGetIntegeri_v(GL_UNIFORM_BUFFER_START, matrixUniformBufferBinding, &mMatrixBufferStart);
+            glGetIntegeri_v(GL_UNIFORM_BUFFER_SIZE, matrixUniformBufferBinding, &mMatrixBufferSize);
+        }
+
+        namespace {
+            void setEnabled(GLenum cap, GLboolean enabled) {
+                if (enabled)
+                    glEnable(cap);
+                else
+                    glDisable(cap);
+            }
+        }
+
+        void StateMemo::restore() const {
+            setEnabled(GL_DEPTH_TEST, mDepthTest);
+            setEnabled(GL_STENCIL_TEST, mStencilTest);
+            setEnabled(GL_CULL_FACE, mCullFace);
+            setEnabled(GL_SCISSOR_TEST, mScissorTest);
+            setEnabled(GL_BLEND, mBlend);
+            if (OPENCSG_HAS_EXT(EXT_depth_bounds_test)) {
+                setEnabled(GL_DEPTH_BOUNDS_TEST_EXT, mDepthBoundsTest);
+                glDepthBoundsEXT(mDepthBounds[0], mDepthBounds[1]);
+            }
+
+            glColorMask(mColorMask[0], mColorMask[1], mColorMask[2], mColorMask[3]);
+            glDepthMask(mDepthMask);
+            glDepthFunc(mDepthFunc);
+            glDepthRange(mDepthRange[0], mDepthRange[1]);
+            glCullFace(mCullFaceMode);
+
+            glStencilFuncSeparate(GL_FRONT, mStencilFunc[0], mStencilRef[0], mStencilValueMask[0]);
+            glStencilFuncSeparate(GL_BACK,  mStencilFunc[1], mStencilRef[1], mStencilValueMask[1]);
+            glStencilMaskSeparate(GL_FRONT, mStencilWriteMask[0]);
+            glStencilMaskSeparate(GL_BACK,  mStencilWriteMask[1]);
+            glStencilOpSeparate(GL_FRONT, mStencilFail[0], mStencilPassDepthFail[0], mStencilPassDepthPass[0]);
+            glStencilOpSeparate(GL_BACK,  mStencilFail[1], mStencilPassDepthFail[1], mStencilPassDepthPass[1]);
+
+            glClearColor(mClearColor[0], mClearColor[1], mClearColor[2], mClearColor[3]);
+            glClearDepth(mClearDepth);
+            glClearStencil(mClearStencil);
+
+            glViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+            glScissor(mScissorBox[0], mScissorBox[1], mScissorBox[2], mScissorBox[3]);
+
+            glUseProgram(mProgram);
+            glBindVertexArray(mVertexArray);
+            glBindBuffer(GL_ARRAY_BUFFER, mArrayBuffer);
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, mTexture2D);
+            glBindTexture(GL_TEXTURE_RECTANGLE, mTextureRectangle);
+            glActiveTexture(mActiveTexture);
+            if (mMatrixBufferSize > 0)
+                glBindBufferRange(GL_UNIFORM_BUFFER, matrixUniformBufferBinding, mMatrixBuffer, mMatrixBufferStart, mMatrixBufferSize);
+            else
+                glBindBufferBase(GL_UNIFORM_BUFFER, matrixUniformBufferBinding, mMatrixBuffer);
+            glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer);
+        }
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
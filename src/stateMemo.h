@@ -0,0 +1,96 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// stateMemo.h
+//
+// saves and restores OpenGL state in core profile contexts
+//
+
+#ifndef __OpenCSG__state_memo_h__
+#define __OpenCSG__state_memo_h__
+
+#include "opencsgConfig.h"
+#include "openglExt.h"
+
+namespace OpenCSG {
+
+    namespace OpenGL {
+
+        class StateMemo {
+        public:
+            /// Saves the OpenGL state that is modified during CSG rendering.
+            /// This replaces glPushAttrib(GL_ALL_ATTRIB_BITS), which is not
+            /// available in core profile contexts. Only state that OpenCSG
+            /// actually touches is saved.
+            StateMemo();
+
+            /// restores the saved OpenGL state
+            void restore() const;
+
+        private:
+            StateMemo(const StateMemo&);
+            StateMemo& operator=(const StateMemo&);
+
+            GLboolean mDepthTest;
+            GLboolean mStencilTest;
+            GLboolean mCullFace;
+            GLboolean mScissorTest;
+            GLboolean mBlend;
+            GLboolean mDepthBoundsTest;
+
+            GLboolean mColorMask[4];
+            GLboolean mDepthMask;
+            GLint mDepthFunc;
+            GLdouble mDepthRange[2];
+            GLint mCullFaceMode;
+
+            // index 0: front faces, index 1: back faces
+            GLint mStencilFunc[2];
+            GLint mStencilRef[2];
+            GLint mStencilValueMask[2];
+            GLint mStencilWriteMask[2];
+            GLint mStencilFail[2];
+            GLint mStencilPassDepthFail[2];
+            GLint mStencilPassDepthPass[2];
+
+            GLfloat mClearColor[4];
+            GLdouble mClearDepth;
+            GLint mClearStencil;
+
+            GLint mViewport[4];
+            GLint mScissorBox[4];
+            GLdouble mDepthBounds[2];
+
+            GLint mProgram;
+            GLint mVertexArray;
+            GLint mArrayBuffer;
+            GLint mActiveTexture;
+            GLint mTexture2D;
+            GLint mTextureRectangle;
+            GLint mUniformBuffer;
+            GLint mMatrixBuffer;
+            GLint mMatrixBufferStart;
+            GLint mMatrixBufferSize;
+        };
+
+    } // namespace OpenGL
+
+} // namespace OpenCSG
+
+#endif // __OpenCSG__state_memo_h__
@@ -0,0 +1,120 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// statistics.cpp
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "context.h"
+#include "gpuTimer.h"
+#include "openglExt.h"
+#include "settings.h"
+#include "statistics.h"
+
+namespace OpenCSG {
+
+    Statistics::Statistics() :
+        algorithm(Automatic),
+        depthComplexityAlgorithm(NoDepthComplexitySampling),
+        cameraOutsideOptimization(OptimizationDefault),
+        primitives(0),
+        culledPrimitives(0),
+        batches(0),
+        sequenceIterations(0),
+        layers(0),
+        stencilClears(0),
+        depthClears(0),
+        channelMerges(0),
+        occlusionQueries(0),
+        occlusionQuerySamples(0),
+        depthComplexity(0),
+        tiles(0),
+        skippedTiles(0),
+        gpuTimedRenders(0),
+        estimatedTime(0.0)
+    {
+        for (int i = 0; i < StatisticsPhaseUnused; ++i) {
+            renderCalls[i] = 0;
+            gpuTime[i] = 0.0;
+        }
+    }
+
+    static thread_local Statistics gStatistics;
+
+    const Statistics& getStatistics() {
+        return gStatistics;
+    }
+
+    void resetStatistics() {
+        gStatistics = Statistics();
+    }
+
+    bool getGPUTimes(double milliseconds[StatisticsPhaseUnused]) {
+#ifndef OPENCSG_NO_STATISTICS
+        if (GLAD_GL_VERSION_3_3)
+            return OpenGL::getGPUTimer()->getLastTimes(milliseconds);
+#endif
+        return false;
+    }
+
+    namespace Stats {
+
+        thread_local Statistics* current = 0;
+        thread_local StatisticsPhase phase = MergePhase;
+
+        static thread_local OpenGL::GPUTimer* gTimer = 0;
+
+        void setPhase(StatisticsPhase p) {
+            phase = p;
+            if (gTimer)
+                gTimer->mark(p);
+        }
+
+        void begin() {
+#ifndef OPENCSG_NO_STATISTICS
+            if (getOption(StatisticsSetting) != 0) {
+                current = &gStatistics;
+            }
+            if (getOption(GPUTimerSetting) != 0 && GLAD_GL_VERSION_3_3) {
+                current = &gStatistics;
+                gTimer = OpenGL::getGPUTimer();
+                gTimer->begin(current);
+            }
+#endif
+        }
+
+        void end() {
+            if (gTimer) {
+                gTimer->end();
+                gTimer = 0;
+            }
+            current = 0;
+        }
+
+        void countClear(Statistics* stats, unsigned int mask) {
+            if (mask & GL_DEPTH_BUFFER_BIT)
+                ++stats->depthClears;
+            if (mask & GL_STENCIL_BUFFER_BIT)
+                ++stats->stencilClears;
+        }
+
+    } // namespace Stats
+
+} // namespace OpenCSG
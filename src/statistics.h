@@ -0,0 +1,71 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// statistics.h
+//
+// collection of the statistics of render()
+//
+
+#ifndef __OpenCSG__statistics_h__
+#define __OpenCSG__statistics_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+
+namespace OpenCSG {
+
+    namespace Stats {
+
+        /// the statistics collected during render(), or 0 if
+        /// collecting statistics is disabled
+        extern thread_local Statistics* current;
+        /// the phase of the CSG algorithm that renders primitives
+        extern thread_local StatisticsPhase phase;
+
+        /// sets the phase, and marks its beginning for the GPU timer
+        void setPhase(StatisticsPhase p);
+
+        /// starts collecting statistics, if enabled by the
+        /// StatisticsSetting or the GPUTimerSetting option
+        void begin();
+        /// stops collecting statistics
+        void end();
+
+        /// counts the buffers cleared by glClear(mask)
+        void countClear(Statistics* stats, unsigned int mask);
+
+    } // namespace Stats
+
+} // namespace OpenCSG
+
+// OPENCSG_STATISTICS(statement) executes the statement only if statistics
+// are collected. The statement can access the statistics as "stats".
+// OPENCSG_STATISTICS_PHASE(phase) sets the phase of the CSG algorithm
+// for counting rendered primitives.
+#ifdef OPENCSG_NO_STATISTICS
+#define OPENCSG_STATISTICS(statement) do { } while (0)
+#define OPENCSG_STATISTICS_PHASE(p) do { } while (0)
+#else
+#define OPENCSG_STATISTICS(statement) \
+    do { if (OpenCSG::Statistics* stats = OpenCSG::Stats::current) { statement; } } while (0)
+#define OPENCSG_STATISTICS_PHASE(p) \
+    do { if (OpenCSG::Stats::current) { OpenCSG::Stats::setPhase(p); } } while (0)
+#endif
+
+#endif // __OpenCSG__statistics_h__
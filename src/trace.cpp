@@ -0,0 +1,146 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// trace.cpp
+//
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+#include "openglExt.h"
+#include "settings.h"
+#include "trace.h"
+#include <chrono>
+#include <cstdio>
+
+namespace OpenCSG {
+
+    TraceCallback::~TraceCallback() {
+    }
+
+    static thread_local TraceCallback* gTraceCallback = 0;
+
+    void setTraceCallback(TraceCallback* callback) {
+        gTraceCallback = callback;
+    }
+
+    TraceCallback* getTraceCallback() {
+        return gTraceCallback;
+    }
+
+    namespace {
+
+        double microsecondsNow() {
+            typedef std::chrono::steady_clock Clock;
+            return std::chrono::duration<double, std::micro>(Clock::now().time_since_epoch()).count();
+        }
+
+        // writes s as JSON string. The names of the scopes are plain
+        // identifiers, so only quotes and backslashes need escaping.
+        void writeString(std::FILE* file, const char* s) {
+            std::fputc('"', file);
+            for (; *s; ++s) {
+                if (*s == '"' || *s == '\\')
+                    std::fputc('\\', file);
+                std::fputc(*s, file);
+            }
+            std::fputc('"', file);
+        }
+
+    } // unnamed namespace
+
+    ChromeTraceRecorder::ChromeTraceRecorder() {
+    }
+
+    ChromeTraceRecorder::~ChromeTraceRecorder() {
+    }
+
+    void ChromeTraceRecorder::beginScope(const char* name, int index) {
+        Event event = { name, index, true, microsecondsNow() };
+        mEvents.push_back(event);
+    }
+
+    void ChromeTraceRecorder::endScope(const char* name, int index) {
+        Event event = { name, index, false, microsecondsNow() };
+        mEvents.push_back(event);
+    }
+
+    void ChromeTraceRecorder::clear() {
+        mEvents.clear();
+    }
+
+    bool ChromeTraceRecorder::write(const std::string& filename) const {
+        std::FILE* file = std::fopen(filename.c_str(), "w");
+        if (!file)
+            return false;
+
+        std::fprintf(file, "{\"traceEvents\":[");
+        for (std::vector<Event>::const_iterator itr = mEvents.begin(); itr != mEvents.end(); ++itr) {
+            std::fprintf(file, "%s\n{\"name\":", itr == mEvents.begin() ? "" : ",");
+            writeString(file, itr->name);
+            std::fprintf(file, ",\"cat\":\"OpenCSG\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1",
+                         itr->begin ? 'B' : 'E', itr->microseconds);
+            if (itr->begin && itr->index >= 0)
+                std::fprintf(file, ",\"args\":{\"index\":%d}", itr->index);
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+        return std::fclose(file) == 0;
+    }
+
+    namespace Trace {
+
+        thread_local bool active = false;
+
+        static thread_local TraceCallback* gCallback = 0;
+        static thread_local bool gDebugGroups = false;
+
+        void begin() {
+#ifndef OPENCSG_NO_TRACE
+            // the callback is kept for the whole call of render(), such
+            // that each scope is ended where it has been begun
+            gCallback = gTraceCallback;
+            gDebugGroups = getOption(DebugGroupSetting) != 0 && GLAD_GL_KHR_debug;
+            active = gCallback || gDebugGroups;
+#endif
+        }
+
+        void end() {
+            active = false;
+            gCallback = 0;
+            gDebugGroups = false;
+        }
+
+        void beginScope(const char* name, int index) {
+            if (gDebugGroups)
+                glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, index < 0 ? 0 : static_cast<GLuint>(index), -1, name);
+            if (gCallback)
+                gCallback->beginScope(name, index);
+        }
+
+        void endScope(const char* name, int index) {
+            if (gCallback)
+                gCallback->endScope(name, index);
+            if (gDebugGroups)
+                glPopDebugGroup();
+        }
+
+    } // namespace Trace
+
+} // namespace OpenCSG
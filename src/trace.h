@@ -0,0 +1,86 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// trace.h
+//
+// reports the scopes of work in render() to the trace callback
+// and as OpenGL debug groups
+//
+
+#ifndef __OpenCSG__trace_h__
+#define __OpenCSG__trace_h__
+
+#include "opencsgConfig.h"
+#include <opencsg.h>
+
+namespace OpenCSG {
+
+    namespace Trace {
+
+        /// true during render() if scopes are reported, either to
+        /// the trace callback or as debug groups
+        extern thread_local bool active;
+
+        /// starts reporting scopes, if enabled by a trace callback or
+        /// the DebugGroupSetting option
+        void begin();
+        /// stops reporting scopes
+        void end();
+
+        /// reports the beginning and end of a scope
+        void beginScope(const char* name, int index);
+        void endScope(const char* name, int index);
+
+        /// reports a scope for its lifetime
+        class Scope {
+        public:
+            Scope(const char* name, int index) : mName(name), mIndex(index), mActive(active) {
+                if (mActive)
+                    beginScope(mName, mIndex);
+            }
+            ~Scope() {
+                if (mActive)
+                    endScope(mName, mIndex);
+            }
+
+        private:
+            Scope(const Scope&);
+            Scope& operator=(const Scope&);
+
+            const char* mName;
+            int mIndex;
+            bool mActive;
+        };
+
+    } // namespace Trace
+
+} // namespace OpenCSG
+
+// OPENCSG_TRACE_SCOPE(name, index) reports a scope from this line to the
+// end of the enclosing block. name must be a string literal.
+#ifdef OPENCSG_NO_TRACE
+#define OPENCSG_TRACE_SCOPE(name, index)
+#else
+#define OPENCSG_TRACE_CONCAT2(a, b) a ## b
+#define OPENCSG_TRACE_CONCAT(a, b) OPENCSG_TRACE_CONCAT2(a, b)
+#define OPENCSG_TRACE_SCOPE(name, index) \
+    OpenCSG::Trace::Scope OPENCSG_TRACE_CONCAT(traceScope, __LINE__)(name, index)
+#endif
+
+#endif // __OpenCSG__trace_h__
@@ -0,0 +1,698 @@
+// OpenCSG - library for image-based CSG rendering for OpenGL
+// Copyright (C) 2002-2026, Florian Kirsch,
+// Hasso-Plattner-Institute at the University of Potsdam, Germany
+//
+// This library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110 - 1301 USA.
+
+//
+// thumbnailService.cpp
+//
+// Implementation of the ThumbnailService (see opencsgThumbnail.h). The
+// workers create their OpenGL contexts with EGL and load the functions
+// they need themselves, since the OpenGL functions loaded by OpenCSG are
+// internal to the library.
+//
+
+#include <opencsgThumbnail.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace OpenCSG {
+
+    ThumbnailShape::ThumbnailShape() :
+        operation(Intersection),
+        convexity(1)
+    {
+        color[0] = color[1] = color[2] = color[3] = 1.0f;
+    }
+
+    ThumbnailJob::ThumbnailJob() :
+        width(128),
+        height(128),
+        color(true)
+    {
+        for (int i = 0; i < 16; ++i) {
+            modelview[i] = projection[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        }
+        for (int i = 0; i < OptionTypeUnused; ++i) {
+            options[i] = 0;
+        }
+        background[0] = background[1] = background[2] = background[3] = 0.0f;
+    }
+
+    ThumbnailImage::ThumbnailImage() :
+        width(0),
+        height(0)
+    {
+    }
+
+    namespace {
+
+        template <typename T>
+        bool loadFunction(T& function, const char* name) {
+            function = reinterpret_cast<T>(eglGetProcAddress(name));
+            return function != 0;
+        }
+
+        /// the OpenGL 3.3 functions used by the workers. With EGL, they
+        /// do not depend on the context, so they are loaded only once
+        struct Functions {
+            PFNGLGENFRAMEBUFFERSPROC genFramebuffers;
+            PFNGLBINDFRAMEBUFFERPROC bindFramebuffer;
+            PFNGLDELETEFRAMEBUFFERSPROC deleteFramebuffers;
+            PFNGLGENRENDERBUFFERSPROC genRenderbuffers;
+            PFNGLBINDRENDERBUFFERPROC bindRenderbuffer;
+            PFNGLDELETERENDERBUFFERSPROC deleteRenderbuffers;
+            PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage;
+            PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer;
+            PFNGLCHECKFRAMEBUFFERSTATUSPROC checkFramebufferStatus;
+            PFNGLGENVERTEXARRAYSPROC genVertexArrays;
+            PFNGLBINDVERTEXARRAYPROC bindVertexArray;
+            PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays;
+            PFNGLGENBUFFERSPROC genBuffers;
+            PFNGLBINDBUFFERPROC bindBuffer;
+            PFNGLBINDBUFFERBASEPROC bindBufferBase;
+            PFNGLDELETEBUFFERSPROC deleteBuffers;
+            PFNGLBUFFERDATAPROC bufferData;
+            PFNGLVERTEXATTRIBPOINTERPROC vertexAttribPointer;
+            PFNGLENABLEVERTEXATTRIBARRAYPROC enableVertexAttribArray;
+            PFNGLCREATESHADERPROC createShader;
+            PFNGLSHADERSOURCEPROC shaderSource;
+            PFNGLCOMPILESHADERPROC compileShader;
+            PFNGLDELETESHADERPROC deleteShader;
+            PFNGLCREATEPROGRAMPROC createProgram;
+            PFNGLATTACHSHADERPROC attachShader;
+            PFNGLLINKPROGRAMPROC linkProgram;
+            PFNGLGETPROGRAMIVPROC getProgramiv;
+            PFNGLUSEPROGRAMPROC useProgram;
+            PFNGLDELETEPROGRAMPROC deleteProgram;
+            PFNGLGETUNIFORMLOCATIONPROC getUniformLocation;
+            PFNGLUNIFORM4FVPROC uniform4fv;
+            PFNGLGETUNIFORMBLOCKINDEXPROC getUniformBlockIndex;
+            PFNGLUNIFORMBLOCKBINDINGPROC uniformBlockBinding;
+
+            bool load() {
+                return loadFunction(genFramebuffers, "glGenFramebuffers")
+                    && loadFunction(bindFramebuffer, "glBindFramebuffer")
+                    && loadFunction(deleteFramebuffers, "glDeleteFramebuffers")
+                    && loadFunction(genRenderbuffers, "glGenRenderbuffers")
+                    && loadFunction(bindRenderbuffer, "glBindRenderbuffer")
+                    && loadFunction(deleteRenderbuffers, "glDeleteRenderbuffers")
+                    && loadFunction(renderbufferStorage, "glRenderbufferStorage")
+                    && loadFunction(framebufferRenderbuffer, "glFramebufferRenderbuffer")
+                    && loadFunction(checkFramebufferStatus, "glCheckFramebufferStatus")
+                    && loadFunction(genVertexArrays, "glGenVertexArrays")
+                    && loadFunction(bindVertexArray, "glBindVertexArray")
+                    && loadFunction(deleteVertexArrays, "glDeleteVertexArrays")
+                    && loadFunction(genBuffers, "glGenBuffers")
+                    && loadFunction(bindBuffer, "glBindBuffer")
+                    && loadFunction(bindBufferBase, "glBindBufferBase")
+                    && loadFunction(deleteBuffers, "glDeleteBuffers")
+                    && loadFunction(bufferData, "glBufferData")
+                    && loadFunction(vertexAttribPointer, "glVertexAttribPointer")
+                    && loadFunction(enableVertexAttribArray, "glEnableVertexAttribArray")
+                    && loadFunction(createShader, "glCreateShader")
+                    && loadFunction(shaderSource, "glShaderSource")
+                    && loadFunction(compileShader, "glCompileShader")
+                    && loadFunction(deleteShader, "glDeleteShader")
+                    && loadFunction(createProgram, "glCreateProgram")
+                    && loadFunction(attachShader, "glAttachShader")
+                    && loadFunction(linkProgram, "glLinkProgram")
+                    && loadFunction(getProgramiv, "glGetProgramiv")
+                    && loadFunction(useProgram, "glUseProgram")
+                    && loadFunction(deleteProgram, "glDeleteProgram")
+                    && loadFunction(getUniformLocation, "glGetUniformLocation")
+                    && loadFunction(uniform4fv, "glUniform4fv")
+                    && loadFunction(getUniformBlockIndex, "glGetUniformBlockIndex")
+                    && loadFunction(uniformBlockBinding, "glUniformBlockBinding");
+            }
+        };
+
+        Functions gl;
+        std::once_flag gLoadFunctions;
+        bool gHaveFunctions = false;
+
+        void loadFunctions() {
+            gHaveFunctions = gl.load();
+        }
+
+        // The vertex shader for OpenCSG and for shading the visible
+        // surfaces afterwards with depth test GL_EQUAL. Both compute
+        // gl_Position in the same way, which is declared invariant, so
+        // that the depth values match exactly.
+        const char csgVertexShader[] =
+            "#version 330 core\n"
+            "layout(std140) uniform OpenCSGMatrices {\n"
+            "    mat4 modelViewMatrix;\n"
+            "    mat4 projectionMatrix;\n"
+            "};\n"
+            "layout(location = 0) in vec4 position;\n"
+            "invariant gl_Position;\n"
+            "void main() {\n"
+            "    gl_Position = projectionMatrix * modelViewMatrix * position;\n"
+            "}\n";
+
+        const char shadeVertexShader[] =
+            "#version 330 core\n"
+            "layout(std140) uniform OpenCSGMatrices {\n"
+            "    mat4 modelViewMatrix;\n"
+            "    mat4 projectionMatrix;\n"
+            "};\n"
+            "layout(location = 0) in vec4 position;\n"
+            "invariant gl_Position;\n"
+            "out vec3 viewPosition;\n"
+            "void main() {\n"
+            "    gl_Position = projectionMatrix * modelViewMatrix * position;\n"
+            "    viewPosition = (modelViewMatrix * position).xyz;\n"
+            "}\n";
+
+        // lit by a light at the camera, with the normal of the triangle,
+        // which faces the camera both for intersected and subtracted shapes
+        const char shadeFragmentShader[] =
+            "#version 330 core\n"
+            "uniform vec4 color;\n"
+            "in vec3 viewPosition;\n"
+            "out vec4 fragColor;\n"
+            "void main() {\n"
+            "    vec3 normal = normalize(cross(dFdx(viewPosition), dFdy(viewPosition)));\n"
+            "    float diffuse = abs(dot(normal, normalize(viewPosition)));\n"
+            "    fragColor = vec4(color.rgb * (0.2 + 0.8 * diffuse), color.a);\n"
+            "}\n";
+
+        const GLuint matrixBinding = 0;
+
+        GLuint compileShader(GLenum type, const char* source) {
+            GLuint shader = gl.createShader(type);
+            gl.shaderSource(shader, 1, &source, 0);
+            gl.compileShader(shader);
+            return shader;
+        }
+
+        /// a job, or a tile of it, as part of the image with the given
+        /// offset and size. The job is shared by the tiles
+        struct Task {
+            std::shared_ptr<const ThumbnailJob> job;
+            int x;
+            int y;
+            int width;
+            int height;
+            std::promise<ThumbnailImage> promise;
+        };
+
+        /// narrows the projection to the tile of task, such that the tile
+        /// fills the viewport. The depth values stay the same
+        void tileProjection(const Task& task, float projection[16]) {
+            const float sx = static_cast<float>(task.job->width) / static_cast<float>(task.width);
+            const float sy = static_cast<float>(task.job->height) / static_cast<float>(task.height);
+            const float tx = static_cast<float>(task.job->width - 2 * task.x - task.width) / static_cast<float>(task.width);
+            const float ty = static_cast<float>(task.job->height - 2 * task.y - task.height) / static_cast<float>(task.height);
+            const float* p = task.job->projection;
+            for (int c = 0; c < 4; ++c) {
+                projection[4 * c + 0] = sx * p[4 * c + 0] + tx * p[4 * c + 3];
+                projection[4 * c + 1] = sy * p[4 * c + 1] + ty * p[4 * c + 3];
+                projection[4 * c + 2] = p[4 * c + 2];
+                projection[4 * c + 3] = p[4 * c + 3];
+            }
+        }
+
+        /// the OpenGL objects of a worker, which are reused for all jobs
+        class Worker {
+        public:
+            explicit Worker(int context);
+            ~Worker();
+
+            /// creates the context and makes it current in the calling thread
+            bool init(EGLDisplay display);
+            /// renders the job or tile of task, with the size of the tile
+            void render(const Task& task, ThumbnailImage& image);
+
+        private:
+            /// makes the framebuffer at least as large as the job needs
+            void resizeFramebuffer(int width, int height);
+            /// creates the primitives of the products, and sets colors
+            /// to the color of each primitive
+            void uploadShapes(const ThumbnailJob& job, std::vector<std::vector<Primitive*> >& products,
+                              std::vector<const float*>& colors);
+
+            int mContext;
+            EGLDisplay mDisplay;
+            EGLContext mEGLContext;
+            GLuint mFramebuffer;
+            GLuint mRenderbuffers[2];
+            int mWidth;
+            int mHeight;
+            GLuint mVertexArray;
+            GLuint mBuffers[2];
+            GLuint mMatrixBuffer;
+            GLuint mProgram;
+            GLint mColorLocation;
+        };
+
+        Worker::Worker(int context) :
+            mContext(context),
+            mDisplay(EGL_NO_DISPLAY),
+            mEGLContext(EGL_NO_CONTEXT),
+            mFramebuffer(0),
+            mWidth(0),
+            mHeight(0),
+            mVertexArray(0),
+            mMatrixBuffer(0),
+            mProgram(0),
+            mColorLocation(-1)
+        {
+            mRenderbuffers[0] = mRenderbuffers[1] = 0;
+            mBuffers[0] = mBuffers[1] = 0;
+        }
+
+        Worker::~Worker() {
+            if (mEGLContext == EGL_NO_CONTEXT)
+                return;
+            if (mFramebuffer) {
+                OpenCSG::freeResources();
+                gl.deleteProgram(mProgram);
+                gl.deleteBuffers(1, &mMatrixBuffer);
+                gl.deleteBuffers(2, mBuffers);
+                gl.deleteVertexArrays(1, &mVertexArray);
+                gl.deleteRenderbuffers(2, mRenderbuffers);
+                gl.deleteFramebuffers(1, &mFramebuffer);
+            }
+            eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(mDisplay, mEGLContext);
+        }
+
+        bool Worker::init(EGLDisplay display) {
+            mDisplay = display;
+            const EGLint configAttribs[] = {
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_NONE
+            };
+            EGLConfig config;
+            EGLint numConfigs = 0;
+            if (!eglBindAPI(EGL_OPENGL_API)
+                || !eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+                return false;
+
+            const EGLint contextAttribs[] = {
+                EGL_CONTEXT_MAJOR_VERSION, 3,
+                EGL_CONTEXT_MINOR_VERSION, 3,
+                EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                EGL_NONE
+            };
+            mEGLContext = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+            if (mEGLContext == EGL_NO_CONTEXT)
+                return false;
+            if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, mEGLContext))
+                return false;
+
+            std::call_once(gLoadFunctions, loadFunctions);
+            if (!gHaveFunctions)
+                return false;
+
+            // the default framebuffer of a surfaceless context is incomplete
+            gl.genFramebuffers(1, &mFramebuffer);
+            gl.genRenderbuffers(2, mRenderbuffers);
+            gl.bindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+            resizeFramebuffer(1, 1);
+            if (gl.checkFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+                return false;
+
+            gl.genVertexArrays(1, &mVertexArray);
+            gl.genBuffers(2, mBuffers);
+            gl.bindVertexArray(mVertexArray);
+            gl.bindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+            gl.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+            gl.enableVertexAttribArray(0);
+            gl.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBuffers[1]);
+            gl.genBuffers(1, &mMatrixBuffer);
+
+            GLuint vertexShader = compileShader(GL_VERTEX_SHADER, shadeVertexShader);
+            GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, shadeFragmentShader);
+            mProgram = gl.createProgram();
+            gl.attachShader(mProgram, vertexShader);
+            gl.attachShader(mProgram, fragmentShader);
+            gl.linkProgram(mProgram);
+            gl.deleteShader(vertexShader);
+            gl.deleteShader(fragmentShader);
+            GLint linked = 0;
+            gl.getProgramiv(mProgram, GL_LINK_STATUS, &linked);
+            if (!linked)
+                return false;
+            gl.uniformBlockBinding(mProgram, gl.getUniformBlockIndex(mProgram, "OpenCSGMatrices"), matrixBinding);
+            mColorLocation = gl.getUniformLocation(mProgram, "color");
+
+            // the state of OpenCSG is per thread, so this is done once
+            OpenCSG::setContext(mContext);
+            OpenCSG::setVertexShader(csgVertexShader);
+            // rather than while rendering the first thumbnail
+            OpenCSG::warmUp();
+            glEnable(GL_DEPTH_TEST);
+            return true;
+        }
+
+        void Worker::resizeFramebuffer(int width, int height) {
+            if (width <= mWidth && height <= mHeight)
+                return;
+            mWidth = (std::max)(width, mWidth);
+            mHeight = (std::max)(height, mHeight);
+            gl.bindRenderbuffer(GL_RENDERBUFFER, mRenderbuffers[0]);
+            gl.renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, mWidth, mHeight);
+            gl.bindRenderbuffer(GL_RENDERBUFFER, mRenderbuffers[1]);
+            gl.renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, mWidth, mHeight);
+            gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mRenderbuffers[0]);
+            gl.framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mRenderbuffers[1]);
+        }
+
+        /// copies the meshes of all shapes into the buffers of the worker
+        /// and creates a BufferPrimitive for each, with its object bounding
+        /// box, so that OpenCSG can cull and batch them
+        void Worker::uploadShapes(const ThumbnailJob& job, std::vector<std::vector<Primitive*> >& products,
+                                  std::vector<const float*>& colors) {
+            std::vector<float> vertices;
+            std::vector<unsigned int> indices;
+            for (std::vector<ThumbnailProduct>::const_iterator product = job.products.begin(); product != job.products.end(); ++product) {
+                products.push_back(std::vector<Primitive*>());
+                for (ThumbnailProduct::const_iterator shape = product->begin(); shape != product->end(); ++shape) {
+                    const std::size_t count = shape->vertices.size() / 3;
+                    if (count == 0 || shape->indices.empty())
+                        continue;
+
+                    float box[6] = { shape->vertices[0], shape->vertices[1], shape->vertices[2],
+                                     shape->vertices[0], shape->vertices[1], shape->vertices[2] };
+                    for (std::size_t v = 1; v < count; ++v) {
+                        for (int c = 0; c < 3; ++c) {
+                            box[c]     = (std::min)(box[c],     shape->vertices[3 * v + c]);
+                            box[c + 3] = (std::max)(box[c + 3], shape->vertices[3 * v + c]);
+                        }
+                    }
+
+                    Primitive* primitive = new BufferPrimitive(shape->operation, shape->convexity, mVertexArray,
+                                                               static_cast<unsigned int>(indices.size()),
+                                                               static_cast<unsigned int>(shape->indices.size()),
+                                                               static_cast<int>(vertices.size() / 3));
+                    primitive->setObjectBoundingBox(box[0], box[1], box[2], box[3], box[4], box[5]);
+                    products.back().push_back(primitive);
+                    colors.push_back(shape->color);
+
+                    vertices.insert(vertices.end(), shape->vertices.begin(), shape->vertices.begin() + 3 * count);
+                    indices.insert(indices.end(), shape->indices.begin(), shape->indices.end());
+                }
+            }
+
+            gl.bindVertexArray(mVertexArray);
+            gl.bindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+            gl.bufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float),
+                          vertices.empty() ? 0 : &vertices[0], GL_STREAM_DRAW);
+            gl.bufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int),
+                          indices.empty() ? 0 : &indices[0], GL_STREAM_DRAW);
+        }
+
+        void Worker::render(const Task& task, ThumbnailImage& image) {
+            const ThumbnailJob& job = *task.job;
+            const int width = task.width;
+            const int height = task.height;
+            if (width < 1 || height < 1)
+                return;
+
+            for (int i = 0; i < OptionTypeUnused; ++i) {
+                setThreadOption(static_cast<OptionType>(i), job.options[i]);
+            }
+            float projection[16];
+            tileProjection(task, projection);
+            setMatrices(job.modelview, projection);
+
+            resizeFramebuffer(width, height);
+            glViewport(0, 0, width, height);
+            glClearColor(job.background[0], job.background[1], job.background[2], job.background[3]);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+            std::vector<std::vector<Primitive*> > products;
+            std::vector<const float*> colors;
+            uploadShapes(job, products, colors);
+
+            glDepthFunc(GL_LESS);
+            for (std::vector<std::vector<Primitive*> >::const_iterator product = products.begin(); product != products.end(); ++product) {
+                OpenCSG::render(*product);
+            }
+
+            if (job.color) {
+                GLfloat matrices[32];
+                std::copy(job.modelview, job.modelview + 16, matrices);
+                std::copy(projection, projection + 16, matrices + 16);
+                gl.bindBuffer(GL_UNIFORM_BUFFER, mMatrixBuffer);
+                gl.bufferData(GL_UNIFORM_BUFFER, sizeof(matrices), matrices, GL_STREAM_DRAW);
+                gl.bindBufferBase(GL_UNIFORM_BUFFER, matrixBinding, mMatrixBuffer);
+
+                gl.useProgram(mProgram);
+                glDepthFunc(GL_EQUAL);
+                std::vector<const float*>::const_iterator color = colors.begin();
+                for (std::vector<std::vector<Primitive*> >::const_iterator product = products.begin(); product != products.end(); ++product) {
+                    for (std::vector<Primitive*>::const_iterator primitive = product->begin(); primitive != product->end(); ++primitive, ++color) {
+                        gl.uniform4fv(mColorLocation, 1, *color);
+                        (*primitive)->render();
+                    }
+                }
+                glDepthFunc(GL_LESS);
+                gl.useProgram(0);
+            }
+
+            image.width = width;
+            image.height = height;
+            image.depth.resize(static_cast<std::size_t>(width) * height);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, &image.depth[0]);
+            if (job.color) {
+                image.color.resize(4 * image.depth.size());
+                glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &image.color[0]);
+            }
+
+            for (std::vector<std::vector<Primitive*> >::iterator product = products.begin(); product != products.end(); ++product) {
+                for (std::vector<Primitive*>::iterator primitive = product->begin(); primitive != product->end(); ++primitive) {
+                    delete *primitive;
+                }
+            }
+        }
+
+    } // unnamed namespace
+
+    struct ThumbnailService::Impl {
+        Impl();
+
+        void run(int index);
+        /// queues the task, or completes it with an empty image if
+        /// there are no workers
+        std::future<ThumbnailImage> enqueue(Task* task);
+
+        EGLDisplay display;
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable queueChanged;
+        std::condition_variable workerStarted;
+        std::deque<Task*> queue;
+        bool stopping;
+        unsigned int started;
+        unsigned int workers;
+    };
+
+    ThumbnailService::Impl::Impl() :
+        display(EGL_NO_DISPLAY),
+        stopping(false),
+        started(0),
+        workers(0)
+    {
+    }
+
+    void ThumbnailService::Impl::run(int index) {
+        Worker worker(-1 - index);
+        const bool valid = worker.init(display);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++started;
+            if (valid)
+                ++workers;
+        }
+        workerStarted.notify_all();
+        if (!valid)
+            return;
+
+        for (;;) {
+            Task* task = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (queue.empty() && !stopping) {
+                    // before idling, release the offscreen buffers that
+                    // OpenCSG has evicted for its memory budget
+                    lock.unlock();
+                    OpenCSG::freeEvictedResources();
+                    lock.lock();
+                }
+                while (queue.empty() && !stopping)
+                    queueChanged.wait(lock);
+                if (queue.empty())
+                    break;
+                task = queue.front();
+                queue.pop_front();
+            }
+
+            ThumbnailImage image;
+            worker.render(*task, image);
+            task->promise.set_value(image);
+            delete task;
+        }
+    }
+
+    ThumbnailService::ThumbnailService(unsigned int workers) :
+        mImpl(new Impl)
+    {
+        if (workers == 0)
+            workers = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay)
+            mImpl->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0);
+        if (mImpl->display == EGL_NO_DISPLAY)
+            mImpl->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        EGLint major, minor;
+        if (mImpl->display == EGL_NO_DISPLAY || !eglInitialize(mImpl->display, &major, &minor)) {
+            mImpl->display = EGL_NO_DISPLAY;
+            return;
+        }
+
+        for (unsigned int i = 0; i < workers; ++i) {
+            mImpl->threads.push_back(std::thread(&Impl::run, mImpl, static_cast<int>(i)));
+        }
+
+        // wait until each worker knows whether it has a context
+        std::unique_lock<std::mutex> lock(mImpl->mutex);
+        while (mImpl->started < workers)
+            mImpl->workerStarted.wait(lock);
+    }
+
+    ThumbnailService::~ThumbnailService() {
+        {
+            std::lock_guard<std::mutex> lock(mImpl->mutex);
+            mImpl->stopping = true;
+        }
+        mImpl->queueChanged.notify_all();
+        for (std::vector<std::thread>::iterator itr = mImpl->threads.begin(); itr != mImpl->threads.end(); ++itr) {
+            itr->join();
+        }
+
+        // without workers, jobs may still be queued
+        for (std::deque<Task*>::iterator itr = mImpl->queue.begin(); itr != mImpl->queue.end(); ++itr) {
+            (*itr)->promise.set_value(ThumbnailImage());
+            delete *itr;
+        }
+        // the display is not terminated, since it is shared with all
+        // other users of EGL in the process
+        delete mImpl;
+    }
+
+    unsigned int ThumbnailService::getWorkers() const {
+        std::lock_guard<std::mutex> lock(mImpl->mutex);
+        return mImpl->workers;
+    }
+
+    std::future<ThumbnailImage> ThumbnailService::Impl::enqueue(Task* task) {
+        std::future<ThumbnailImage> result = task->promise.get_future();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (workers == 0) {
+            lock.unlock();
+            task->promise.set_value(ThumbnailImage());
+            delete task;
+            return result;
+        }
+        queue.push_back(task);
+        lock.unlock();
+        queueChanged.notify_one();
+        return result;
+    }
+
+    std::future<ThumbnailImage> ThumbnailService::submit(const ThumbnailJob& job) {
+        Task* task = new Task;
+        task->job = std::make_shared<const ThumbnailJob>(job);
+        task->x = 0;
+        task->y = 0;
+        task->width = job.width;
+        task->height = job.height;
+        return mImpl->enqueue(task);
+    }
+
+    ThumbnailImage ThumbnailService::renderTiled(const ThumbnailJob& job, int tileSize) {
+        ThumbnailImage image;
+        if (job.width < 1 || job.height < 1 || tileSize < 1)
+            return image;
+
+        // the tiles share the job, and are queued row by row. The tasks are
+        // deleted by the workers, so their positions are kept here
+        std::shared_ptr<const ThumbnailJob> shared = std::make_shared<const ThumbnailJob>(job);
+        std::vector<int> positions;
+        std::vector<std::future<ThumbnailImage> > results;
+        for (int y = 0; y < job.height; y += tileSize) {
+            for (int x = 0; x < job.width; x += tileSize) {
+                Task* task = new Task;
+                task->job = shared;
+                task->x = x;
+                task->y = y;
+                task->width = (std::min)(tileSize, job.width - x);
+                task->height = (std::min)(tileSize, job.height - y);
+                positions.push_back(x);
+                positions.push_back(y);
+                results.push_back(mImpl->enqueue(task));
+            }
+        }
+
+        image.width = job.width;
+        image.height = job.height;
+        image.depth.resize(static_cast<std::size_t>(job.width) * job.height);
+        if (job.color)
+            image.color.resize(4 * image.depth.size());
+        for (std::size_t t = 0; t < results.size(); ++t) {
+            const ThumbnailImage tile = results[t].get();
+            if (tile.width == 0) {
+                // wait for the other tiles, which may still be rendered
+                for (++t; t < results.size(); ++t) {
+                    results[t].wait();
+                }
+                return ThumbnailImage();
+            }
+            const std::size_t x = positions[2 * t];
+            const std::size_t y = positions[2 * t + 1];
+            for (int row = 0; row < tile.height; ++row) {
+                const std::size_t source = static_cast<std::size_t>(row) * tile.width;
+                const std::size_t target = (y + row) * job.width + x;
+                std::copy(tile.depth.begin() + source, tile.depth.begin() + source + tile.width, image.depth.begin() + target);
+                if (job.color)
+                    std::copy(tile.color.begin() + 4 * source, tile.color.begin() + 4 * (source + tile.width), image.color.begin() + 4 * target);
+            }
+        }
+
+        return image;
+    }
+
+} // namespace OpenCSG